@@ -0,0 +1,63 @@
+// Regression check for the FFT worker: every backend and codelet size against a naive DFT.
+//
+//   node check.js [--sizes 8,16,32,64,256] [--codelets 8,16,32]
+//
+// Forward and inverse transforms of real and complex inputs (Float32Array and Uint8Array) are run through the worker's
+// own message handler and compared, unnormalised, with the textbook DFT. Exits with 1 on the first mismatch or throw.
+const { engine } = require('./shards');
+
+const { PI, cos, sin, abs, max } = Math;
+const settings = { sizes: [8, 16, 32, 64, 256], codelets: [8, 16, 32], tolerance: 1e-4 };
+
+const parseArguments = (args, options = {}) => {
+    for (let i = 0; i < args.length; i++)
+        args[i].startsWith('--') && (options[args[i].slice(2)] = args[++i]);
+    return options;
+};
+
+/** Unnormalised DFT of interleaved complex (or real) input; sign -1 is the forward transform, +1 the inverse. */
+const dft = (input, fromReal, sign) => {
+    const n = fromReal ? input.length : input.length / 2, output = new Float64Array(n * 2);
+    for (let k = 0; k < n; k++)
+        for (let m = 0, angle, re, im; m < n; m++)
+            angle = 2 * PI * k * m / n, re = fromReal ? input[m] : input[m * 2], im = fromReal ? 0 : input[m * 2 + 1],
+                output[k * 2] += re * cos(angle) - sign * im * sin(angle), output[k * 2 + 1] += sign * re * sin(angle) + im * cos(angle);
+    return output;
+};
+
+const check = ({ sizes = settings.sizes, codelets = settings.codelets, tolerance = settings.tolerance } = {}, run = engine()) => {
+    const failures = [], backends = ['js', ...run({ action: 'backend', backend: 'wasm' }).supported ? ['wasm'] : []];
+    let checked = 0;
+    for (const name of backends)
+        for (const size of sizes)
+            for (const codelet of name === 'js' ? codelets.filter(codelet => codelet <= size || codelet === codelets[0]) : [0]) {
+                run({ action: 'backend', backend: name }), run({ action: 'wisdom', wisdom: { [size]: { backend: name, codelet: codelet || undefined } } });
+                for (const type of [Float32Array, Uint8Array])
+                    for (const fromReal of [true, false])
+                        for (const action of ['forward', 'inverse']) {
+                            const input = type.from({ length: fromReal ? size : size * 2 }, (_, i) => (i * 37 + (i >> 2) * 11) % 23);
+                            const label = `${name} ${size} codelet ${codelet || '–'} ${type.name} ${fromReal ? 'real' : 'complex'} ${action}`;
+                            try {
+                                const { output, done } = run({ action, input, output: new Float32Array(size * 2) }) || {};
+                                const expected = dft(input, fromReal, action === 'forward' ? -1 : 1);
+                                let error = 0, scale = 1;
+                                for (let i = 0; i < expected.length; i++)
+                                    error = max(error, abs(expected[i] - output[i])), scale = max(scale, abs(expected[i]));
+                                checked++, (!done || !(error / scale <= tolerance)) && failures.push(`${label}: ${done ? `error ${(error / scale).toExponential(2)}` : 'not done'}`);
+                            }
+                            catch (exception) {
+                                checked++, failures.push(`${label}: ${exception.message || exception}`);
+                            }
+                        }
+            }
+    return run({ action: 'backend', backend: 'auto' }), { checked, failures };
+};
+
+module.exports = { dft, check };
+
+if (require.main === module) {
+    const options = parseArguments(process.argv.slice(2)), list = (value) => value && `${value}`.split(',').map(Number);
+    const { checked, failures } = check({ sizes: list(options.sizes), codelets: list(options.codelets), tolerance: options.tolerance && +options.tolerance });
+    failures.forEach(failure => console.error(failure));
+    console.log(`${checked - failures.length}/${checked} transforms match the DFT`), failures.length && (process.exitCode = 1);
+}
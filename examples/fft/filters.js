@@ -0,0 +1,35 @@
+// The demo's filter registry (modules/nerdy-fft/turbomaze/filter.js) for the headless runners.
+//
+//   const { filter, shapes } = require('./filters');
+//   filter([256, 256], 10, 40, { shape: 'butterworth', order: 4 });
+//
+// The module is evaluated straight out of framework.js, so shards.js, report.js and replay.js build the same masks as
+// the demo for every shape (ideal, gaussian, butterworth, raised-cosine, radial and any shape registered later) instead
+// of keeping their own copy. Its only import is nerdy-utils, of which it uses Math plus diagonal().
+const fs = require('fs'), path = require('path'), vm = require('vm');
+
+const bundle = path.join(__dirname, 'framework.js'), name = 'modules/nerdy-fft/turbomaze/filter.js';
+
+const load = (file = bundle) => {
+    const source = fs.readFileSync(file, 'utf8'), marker = `___scope___.file("${name}",`, start = source.indexOf(marker);
+    if (start < 0) throw Error(`${name} is missing from ${file}`);
+    const end = source.indexOf('),___scope___.file(', start), utilities = Object.assign(Object.create(Math), { diagonal: (a, b = a) => Math.ceil(Math.hypot(a, b)) });
+    const factory = vm.runInNewContext(`(${source.slice(start + marker.length, end)})`, { Math, _Mathmax: Math.max, _Mathmin: Math.min, Float32Array, Map, Object, isNaN, isFinite, Number }, { filename: file });
+    const module = { exports: {} };
+    return factory(module.exports, () => utilities, module, name, path.dirname(name)), module.exports;
+};
+
+const registry = load();
+
+/** Parameters a recorded or queued filter passes on to its shape, e.g. { shape: 'radial', curve: '0,1,1,0' }. */
+const shapeParameters = ({ shape, curve, sigma, order, rolloff } = {}) =>
+    Object.entries({ shape, curve, sigma, order, rolloff }).reduce((parameters, [key, value]) => (value === undefined || (parameters[key] = value), parameters), {});
+
+/** A centred size × size (or [width, height]) mask for a [low, high] band (all-pass without one), built by the registered shape. */
+const bandFilter = (size, [low, high] = [], parameters = {}) => {
+    const [width, height] = Array.isArray(size) ? size : [size, size];
+    if (!(low > 0 || high > 0)) return new Float32Array(width * height).fill(1);
+    return Float32Array.from(registry.filter([width, height], low > 0 ? low : NaN, high > 0 ? high : NaN, shapeParameters(parameters)));
+};
+
+module.exports = { load, filter: registry.filter, shapes: registry.filterShapes, shapeParameters, bandFilter };
@@ -0,0 +1,95 @@
+// Streaming stage orchestrator: items flow through bounded channels so every stage works on a different item at once.
+//
+//   const { results, metrics } = await pipeline(items, [
+//       { name: 'read', concurrency: 4, run: (item) => fs.promises.readFile(item) },
+//       { name: 'decode', run: (buffer) => decode(buffer) },
+//   ], { capacity: 4 });
+//
+// A stage pulls from its input channel, runs, and pushes to its output channel, waiting while that channel is full
+// (backpressure). Metrics record per stage how long it was busy, starved (waiting for input) and blocked (waiting
+// for space downstream), so the slowest stage is the one with the highest utilisation and the others show starvation.
+// Busy time of an asynchronous stage is wall time, so it also counts any wait for the event loop behind synchronous stages.
+// Passing an AbortSignal as `signal` stops feeding new items once it fires; items already in flight are dropped unrun.
+const { performance } = require('perf_hooks');
+
+const now = () => performance.now();
+
+class Channel {
+    constructor(capacity = 4) {
+        this.capacity = Math.max(1, capacity), this.items = [], this.pullers = [], this.pushers = [], this.closed = false, this.peak = 0;
+    }
+    push(item) {
+        if (this.pullers.length) return this.pullers.shift()({ value: item, done: false }), Promise.resolve();
+        if (this.items.length < this.capacity) return this.items.push(item), this.peak = Math.max(this.peak, this.items.length), Promise.resolve();
+        return new Promise((resolve) => this.pushers.push(() => (this.items.push(item), this.peak = Math.max(this.peak, this.items.length), resolve())));
+    }
+    pull() {
+        if (this.items.length) {
+            const value = this.items.shift();
+            this.pushers.length && this.pushers.shift()();
+            return Promise.resolve({ value, done: false });
+        }
+        if (this.closed) return Promise.resolve({ value: undefined, done: true });
+        return new Promise((resolve) => this.pullers.push(resolve));
+    }
+    close() {
+        this.closed = true;
+        while (this.pullers.length && !this.items.length) this.pullers.shift()({ value: undefined, done: true });
+    }
+}
+
+const metrics = (name, concurrency) => ({ name, concurrency, items: 0, errors: 0, busy: 0, starved: 0, blocked: 0, peak: 0, utilisation: 0 });
+
+/** Runs one stage with `concurrency` lanes between two channels; errors drop the item and are reported through onError. */
+const stage = async ({ name, run, concurrency = 1 }, input, output, stats, onError, signal) => {
+    const lane = async () => {
+        for (let started = now(), pulled; !(pulled = await input.pull()).done; started = now()) {
+            const ready = now(), { value: { index, item, entered } } = pulled;
+            stats.starved += ready - started;
+            if (signal && signal.aborted) continue;
+            let result, failed = false;
+            try { result = await run(item, index); }
+            catch (exception) { failed = true, stats.errors++, onError && onError(exception, { stage: name, index, item }); }
+            const finished = now();
+            stats.busy += finished - ready, stats.items++;
+            if (!failed) await output.push({ index, item: result, entered }), stats.blocked += now() - finished;
+        }
+    };
+    await Promise.all(Array.from({ length: Math.max(1, concurrency) }, lane));
+    output.close();
+};
+
+/** Streams items through stages and resolves with the last stage's outputs (in input order) and per-stage metrics. */
+const pipeline = async (items, stages, { capacity = 4, onError, onResult, signal } = {}) => {
+    const channels = Array.from({ length: stages.length + 1 }, () => new Channel(capacity)), started = now();
+    const stats = stages.map(({ name, concurrency = 1 }) => metrics(name, concurrency)), latencies = [], results = [];
+    const running = stages.map((definition, i) => stage(definition, channels[i], channels[i + 1], stats[i], onError, signal));
+    const feeding = (async () => {
+        let index = 0;
+        for (const item of items) {
+            if (signal && signal.aborted) break;
+            await channels[0].push({ index: index++, item, entered: now() });
+        }
+        channels[0].close();
+    })();
+    const draining = (async () => {
+        for (let pulled; !(pulled = await channels[stages.length].pull()).done;) {
+            const { index, item, entered } = pulled.value;
+            results[index] = item, latencies.push(now() - entered), onResult && onResult(item, index);
+        }
+    })();
+    await Promise.all([feeding, ...running, draining]);
+    const elapsed = now() - started;
+    for (const [i, stat] of stats.entries())
+        stat.peak = channels[i + 1].peak, stat.utilisation = elapsed > 0 ? stat.busy / (elapsed * stat.concurrency) : 0;
+    const slowest = stats.reduce((slowest, stat) => stat.busy / stat.concurrency > slowest.busy / slowest.concurrency ? stat : slowest, stats[0]);
+    return {
+        results, aborted: !!(signal && signal.aborted), metrics: {
+            elapsed, stages: stats, slowest: slowest && slowest.name,
+            sum: stats.reduce((sum, stat) => sum + stat.busy / stat.concurrency, 0),
+            latency: latencies.length ? { mean: latencies.reduce((a, b) => a + b, 0) / latencies.length, max: Math.max(...latencies) } : undefined,
+        },
+    };
+};
+
+module.exports = { Channel, pipeline };
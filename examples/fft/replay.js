@@ -0,0 +1,228 @@
+// Headless session replay: drives recorded IQ:FFT Demo interactions through the engine as a regression benchmark.
+//
+//   node replay.js <session.json …> [--speed 1] [--root <dir>] [--images <dir>] [--out report.json]
+//                  [--baseline report.json] [--tolerance 0.25]
+//
+// Sessions are the logs the demo's Record button downloads (app/modules/session): the initial state and a compact list of
+// [delta ms, code, …] events — property changes, drops, zooms and the moments the inverse was rendered. Events are
+// replayed at their recorded times against the demo's stage graph (image → forward, filter → inverse). Like the demo,
+// a stage is only recomputed when an event invalidates it, and events that arrive while work is pending supersede it:
+// stages already computed for the outdated state count as aborted (and their time as wasted), and the events they
+// served never get a render of their own. Each event's latency runs from its recorded time to the next render.
+// Filters are built by the demo's shape registry (filters.js) with the recorded filterShape and filterCurve, and
+// canvasAspect changes resize the canvas to the demo's rectangular width × height.
+//
+// Library URLs are mapped onto --root (default: this folder) by their path; dropped files are looked up by name in
+// --images. Images that cannot be found or decoded are replaced with samples/checkerboard.png and counted.
+//
+// With --baseline, mean/p95 latency, wasted time and peak memory are compared against an earlier report and the run
+// exits with 1 when any of them regressed by more than --tolerance.
+const fs = require('fs'), path = require('path');
+const { performance } = require('perf_hooks');
+const { png, resample, engine } = require('./shards'), { bandFilter } = require('./filters');
+
+const { min, max, round } = Math;
+const settings = { speed: 1, root: __dirname, images: undefined, tolerance: 0.25, fallback: path.join(__dirname, 'samples', 'checkerboard.png') };
+const types = { p: 'property', d: 'drop', z: 'zoom', r: 'rendered' };
+
+const parseArguments = (args, options = {}) => {
+    const positional = [];
+    for (let i = 0; i < args.length; i++)
+        args[i].startsWith('--') ? (options[args[i].slice(2)] = args[++i]) : positional.push(args[i]);
+    return { positional, options };
+};
+
+/** Absolute event times from the recorder's delta encoding (mirrors session.expand in the framework). */
+const expand = ({ events = [] } = {}) => {
+    let time = 0;
+    return events.map(([delta, code, name, value]) => (time += delta, code === 'p' ? { time, type: types[code], name, value } : { time, type: types[code], value: name }));
+};
+
+const stages = ['image', 'forward', 'filter', 'inverse'];
+const upstream = { image: [], forward: ['image'], filter: [], inverse: ['forward', 'filter'] };
+const effects = { sourceURI: ['image'], canvasSize: ['image', 'filter'], canvasAspect: ['image', 'filter'], bandFilter: ['filter'], filterShape: ['filter'], filterCurve: ['filter'], bandPassMode: ['inverse'], autoContrast: ['inverse'] };
+
+/** Stages an event makes outdated, including everything downstream of them; zooms and view toggles only repaint. */
+const invalidates = (event) => {
+    const dirty = new Set(event.type === 'drop' ? ['image'] : event.type === 'property' && effects[event.name] || []);
+    for (const stage of stages)
+        upstream[stage].some(name => dirty.has(name)) && dirty.add(stage);
+    return dirty;
+};
+
+const percentile = (values, p) => {
+    const sorted = Float64Array.from(values).sort();
+    return sorted.length ? sorted[min(sorted.length - 1, max(0, Math.ceil(p * sorted.length) - 1))] : undefined;
+};
+const summary = (values) => values.length ? { mean: values.reduce((a, b) => a + b, 0) / values.length, p50: percentile(values, 0.5), p95: percentile(values, 0.95), max: max(...values) } : undefined;
+
+/** Demo state for one session and the work each stage does for it. */
+class Replay {
+    constructor(log, { root = settings.root, images = settings.images, run = engine() } = {}) {
+        const initial = log.initial || {};
+        this.run = run, this.root = root, this.imagesDirectory = images, this.decoded = new Map(), this.substituted = [];
+        this.state = {
+            size: +initial.canvasSize || log.size || 256, aspect: +initial.canvasAspect || 1, band: initial.bandFilter || [], shape: initial.filterShape, curve: initial.filterCurve, pass: initial.bandPassMode !== false, autoContrast: initial.autoContrast !== false, source: { uri: initial.sourceURI },
+        };
+    }
+    apply({ type, name, value }) {
+        const { state } = this;
+        if (type === 'drop') state.source = { drop: value || {} };
+        else if (type !== 'property') return;
+        else if (name === 'sourceURI') state.source = { uri: value };
+        else if (name === 'canvasSize') state.size = max(64, min(4096, +value || state.size));
+        else if (name === 'canvasAspect') state.aspect = +value || 1;
+        else if (name === 'bandFilter') state.band = value || [];
+        else if (name === 'filterShape') state.shape = value;
+        else if (name === 'filterCurve') state.curve = value;
+        else if (name === 'bandPassMode') state.pass = value !== false;
+        else if (name === 'autoContrast') state.autoContrast = !!value;
+    }
+    candidates({ uri, drop }) {
+        if (drop) return drop.name && this.imagesDirectory ? [path.resolve(this.imagesDirectory, drop.name)] : [];
+        if (!uri || /^(blob|data):/.test(uri)) return [];
+        const segments = decodeURIComponent(new URL(uri, 'file:///').pathname).split('/').filter(Boolean);
+        return segments.map((_, index) => path.join(this.root, ...segments.slice(index)));
+    }
+    source(source = this.state.source) {
+        const key = source.drop ? `drop:${source.drop.name}` : `${source.uri}`.split('?')[0];
+        if (!this.decoded.has(key)) {
+            let image;
+            for (const file of this.candidates(source))
+                try { image = png.decode(fs.readFileSync(file)); break; } catch (exception) { }
+            image || (this.substituted.push(key), image = png.decode(fs.readFileSync(settings.fallback)));
+            this.decoded.set(key, image);
+        }
+        return this.decoded.get(key);
+    }
+    /** Canvas width and height for the current size and aspect, as IQFFTDemo._canvasWidth/_canvasHeight compute them. */
+    get dimensions() {
+        const { size, aspect } = this.state;
+        return aspect > 1 ? [size, size / aspect] : [size * aspect, size];
+    }
+    image() { this.input = resample(this.source(), this.dimensions); }
+    forward() { this.run({ action: 'batch', key: 'replay', inputs: [this.input] }); }
+    filter() { this.filterData = bandFilter(this.dimensions, this.state.band, { shape: this.state.shape, curve: this.state.curve }); }
+    inverse() {
+        const { pass, autoContrast } = this.state, [width, height] = this.dimensions;
+        const { outputs: [output] = [], ranges: [[low, high] = [0, 1]] = [] } = this.run({ action: 'filterInverse', key: 'replay', filter: this.filterData, width, stop: !pass }) || {};
+        const pixels = this.pixels && this.pixels.length === width * height ? this.pixels : this.pixels = new Uint8ClampedArray(width * height);
+        const offset = autoContrast ? low : 0, scale = autoContrast ? 255 / (high - low || 1) : 1;
+        for (let i = 0; output && i < output.length; i++)
+            pixels[i] = (output[i] - offset) * scale;
+    }
+}
+
+const sleep = (ms) => ms > 0 ? new Promise(resolve => setTimeout(resolve, ms)) : Promise.resolve();
+
+const memory = (peak = {}) => {
+    const usage = process.memoryUsage();
+    for (const key of ['rss', 'heapUsed', 'arrayBuffers'])
+        peak[key] = max(peak[key] || 0, usage[key] || 0);
+    return peak;
+};
+
+/** Replays one session log in real time (scaled by speed) and reports per-event latency, superseded work and memory. */
+const replay = async (log, { speed = settings.speed, ...options } = {}) => {
+    speed = +speed > 0 ? +speed : 1;
+    const session = new Replay(log, options), all = expand(log), inputs = all.filter(event => event.type !== 'rendered');
+    const timings = stages.reduce((timings, stage) => (timings[stage] = { runs: 0, aborted: 0, time: 0, max: 0 }, timings), {});
+    const baseline = memory(), peak = memory({});
+    const execute = (stage) => {
+        const started = performance.now();
+        session[stage]();
+        const elapsed = performance.now() - started, timing = timings[stage];
+        return timing.runs++, timing.time += elapsed, timing.max = max(timing.max, elapsed), memory(peak), elapsed;
+    };
+    for (const stage of stages)
+        execute(stage);
+    const origin = performance.now(), due = (event) => origin + event.time / speed;
+    const records = [], dirty = new Set(), computed = new Map();
+    let waiting = [], renders = 0, aborted = 0, wasted = 0;
+    for (let next = 0; next < inputs.length || dirty.size;) {
+        if (next < inputs.length && (!dirty.size || performance.now() >= due(inputs[next]))) {
+            const event = inputs[next++];
+            await sleep(due(event) - performance.now());
+            session.apply(event);
+            const hits = invalidates(event), record = { time: event.time, type: event.type, name: event.name, stages: [...hits] };
+            records.push(record);
+            if (!hits.size) {
+                record.latency = max(0, performance.now() - due(event));
+                continue;
+            }
+            for (const stage of hits)
+                computed.has(stage) && (aborted++, timings[stage].aborted++, wasted += computed.get(stage), computed.delete(stage)), dirty.add(stage);
+            for (const pending of waiting)
+                pending.superseded = true;
+            waiting.push(Object.assign(record, { due: due(event) }));
+            continue;
+        }
+        const stage = stages.find(stage => dirty.has(stage));
+        computed.set(stage, execute(stage)), dirty.delete(stage);
+        if (dirty.size) continue;
+        const rendered = performance.now();
+        for (const record of waiting)
+            record.latency = rendered - record.due, delete record.due;
+        renders++, waiting = [], computed.clear();
+        await sleep(0);
+    }
+    const recorded = [];
+    for (let i = 0, r = 0; i < all.length; i++)
+        if (all[i].type !== 'rendered' && invalidates(all[i]).size) {
+            while (r < all.length && (all[r].type !== 'rendered' || all[r].time < all[i].time)) r++;
+            r < all.length && recorded.push((all[r].time - all[i].time) / speed);
+        }
+    const latencies = records.filter(record => record.stages.length && isFinite(record.latency)).map(record => record.latency);
+    for (const timing of Object.values(timings))
+        timing.time = round(timing.time * 100) / 100, timing.max = round(timing.max * 100) / 100;
+    return {
+        started: log.started, duration: all.length ? all[all.length - 1].time : 0, speed, size: session.state.size, dimensions: session.dimensions,
+        events: records.length, computed: latencies.length, renders, superseded: records.filter(record => record.superseded).length, aborted, wasted,
+        latency: summary(latencies), recorded: summary(recorded), stages: timings,
+        memory: { baseline, peak, growth: { rss: peak.rss - baseline.rss, heapUsed: peak.heapUsed - baseline.heapUsed, arrayBuffers: peak.arrayBuffers - baseline.arrayBuffers } },
+        substituted: session.substituted, records,
+    };
+};
+
+/** Metrics that regressed against a baseline report by more than the tolerance (as a fraction). */
+const compare = (report, baseline, tolerance = settings.tolerance) => {
+    const metrics = { 'latency.mean': r => r.latency && r.latency.mean, 'latency.p95': r => r.latency && r.latency.p95, wasted: r => r.wasted, 'memory.growth.rss': r => r.memory && r.memory.growth.rss };
+    const regressions = [];
+    for (const name in metrics) {
+        const current = metrics[name](report), previous = metrics[name](baseline);
+        isFinite(current) && previous > 0 && current > previous * (1 + +tolerance) && regressions.push({ name, previous, current, change: current / previous - 1 });
+    }
+    return regressions;
+};
+
+const format = (name, report) => {
+    const ms = (value) => isFinite(value) ? `${value.toFixed(1)} ms` : '–', { latency = {}, recorded, memory: { growth } } = report;
+    return [
+        `${name}: ${report.events} events over ${(report.duration / 1000).toFixed(1)} s at ${report.speed}× → ${report.renders} renders, ${report.superseded} superseded, ${report.aborted} aborted (${ms(report.wasted)} wasted)`,
+        `  latency mean ${ms(latency.mean)}, p50 ${ms(latency.p50)}, p95 ${ms(latency.p95)}, max ${ms(latency.max)}${recorded ? ` (recorded p95 ${ms(recorded.p95)})` : ''}`,
+        `  stages ${stages.map(stage => `${stage} ${report.stages[stage].runs}×${ms(report.stages[stage].time / (report.stages[stage].runs || 1))}`).join(', ')}`,
+        `  memory +${(growth.rss / 2 ** 20).toFixed(1)} MiB rss, +${(growth.arrayBuffers / 2 ** 20).toFixed(1)} MiB array buffers${report.substituted.length ? `; substituted ${report.substituted.join(', ')}` : ''}`,
+    ].join('\n');
+};
+
+module.exports = { expand, invalidates, Replay, replay, compare };
+
+if (require.main === module) {
+    const { positional: files, options } = parseArguments(process.argv.slice(2));
+    if (!files.length) console.error(`Usage: node replay.js <session.json …> [--speed 1] [--root <dir>] [--images <dir>] [--out report.json] [--baseline report.json]`), process.exit(1);
+    (async () => {
+        const reports = {}, run = engine();
+        for (const file of files) {
+            reports[path.basename(file)] = await replay(JSON.parse(fs.readFileSync(file, 'utf8')), Object.assign({ run }, options));
+            console.log(format(path.basename(file), reports[path.basename(file)]));
+        }
+        options.out && fs.writeFileSync(options.out, JSON.stringify(reports, null, 1));
+        if (!options.baseline) return;
+        const baseline = JSON.parse(fs.readFileSync(options.baseline, 'utf8')), regressions = [];
+        for (const name in reports)
+            baseline[name] && regressions.push(...compare(reports[name], baseline[name], options.tolerance).map(regression => Object.assign({ session: name }, regression)));
+        for (const { session, name, previous, current, change } of regressions)
+            console.error(`${session}: ${name} regressed ${(change * 100).toFixed(0)}% (${previous.toFixed(1)} → ${current.toFixed(1)})`);
+        regressions.length && (process.exitCode = 1);
+    })().catch(exception => (console.error(exception), process.exit(1)));
+}
@@ -0,0 +1,245 @@
+// Batch report sheets: one PNG per patch (gray, spectrum, filter overlay, inverse and score bars) plus an index.html.
+//
+//   node report.js <manifest.json> <directory> [--size 256] [--band low:high] [--shape gaussian] [--curve 0,1,0] [--screenings am-120-30,fm-1200]
+//                  [--scorers contrast,energy,modulation,resolved] [--threads <cpus>] [--level 3] [--capacity 8]
+//
+// Patches stream through the same read → inflate → extract stages as the shard runner on the main thread (PNGs are
+// inflated, the vector screening's SVGs rasterised; any other format becomes an error row in the index), then go to a
+// pool of sheet threads. Each thread runs its own engine, composes the panels into a pooled sheet buffer and encodes
+// it: rows are filtered, deflated as a stream and every deflate chunk is written as its own IDAT. The input buffer
+// is handed back to the main thread's pool with the scores.
+const fs = require('fs'), path = require('path'), os = require('os'), zlib = require('zlib'), { promisify } = require('util');
+const { Worker, isMainThread, parentPort, workerData } = require('worker_threads');
+
+const { floor, min, max, log1p } = Math;
+
+const encoder = {
+    signature: Buffer.from([137, 80, 78, 71, 13, 10, 26, 10]),
+    table: Int32Array.from({ length: 256 }, (_, n) => { for (let k = 0; k < 8; k++)
+        n = n & 1 ? 0xedb88320 ^ (n >>> 1) : n >>> 1; return n; }),
+    crc(buffer, crc = -1) {
+        for (let i = 0; i < buffer.length; i++)
+            crc = encoder.table[(crc ^ buffer[i]) & 255] ^ (crc >>> 8);
+        return (crc ^ -1) >>> 0;
+    },
+    chunk(type, data = Buffer.alloc(0)) {
+        const chunk = Buffer.alloc(data.length + 12);
+        chunk.writeUInt32BE(data.length, 0), chunk.write(type, 4, 'latin1'), data.copy(chunk, 8);
+        return chunk.writeUInt32BE(encoder.crc(chunk.subarray(4, 8 + data.length)), 8 + data.length), chunk;
+    },
+    /** Writes one filtered row, choosing None, Sub, Up or Paeth by the smallest sum of absolute residuals. */
+    row(pixels, y, stride, bpp, output, offset, scratch = encoder.scratch(stride)) {
+        const line = pixels.subarray(y * stride, (y + 1) * stride), above = y ? pixels.subarray((y - 1) * stride, y * stride) : scratch.zeros;
+        const [sub, up, paeth] = scratch.rows, sums = [0, 0, 0, 0];
+        for (let x = 0, v; x < stride; x++)
+            v = line[x], sums[0] += v < 128 ? v : 256 - v;
+        for (let x = 0, v; x < stride; x++)
+            v = sub[x] = (line[x] - (x >= bpp ? line[x - bpp] : 0)) & 255, sums[1] += v < 128 ? v : 256 - v;
+        for (let x = 0, v; x < stride; x++)
+            v = up[x] = (line[x] - above[x]) & 255, sums[2] += v < 128 ? v : 256 - v;
+        for (let x = 0, a, b, c, p, pa, pb, pc, v; x < stride; x++)
+            a = x >= bpp ? line[x - bpp] : 0, b = above[x], c = x >= bpp ? above[x - bpp] : 0, p = a + b - c,
+                pa = p > a ? p - a : a - p, pb = p > b ? p - b : b - p, pc = p > c ? p - c : c - p,
+                v = paeth[x] = (line[x] - (pa <= pb && pa <= pc ? a : pb <= pc ? b : c)) & 255, sums[3] += v < 128 ? v : 256 - v;
+        let best = 0;
+        for (let i = 1; i < 4; i++)
+            sums[i] < sums[best] && (best = i);
+        output[offset] = [0, 1, 2, 4][best], output.set(best ? scratch.rows[best - 1] : line, offset + 1);
+    },
+    scratch: (stride) => ({ zeros: new Uint8Array(stride), rows: [new Uint8Array(stride), new Uint8Array(stride), new Uint8Array(stride)] }),
+    /** Streams an 8-bit RGB image to `file`; resolves with the number of bytes written. */
+    write(file, width, height, pixels, { level = 3, block = 32 } = {}) {
+        return new Promise((resolve, reject) => {
+            const output = fs.createWriteStream(file), deflate = zlib.createDeflate({ level, chunkSize: 1 << 16 }), stride = width * 3, header = Buffer.alloc(13), scratch = encoder.scratch(stride);
+            let bytes = 0;
+            const put = (buffer) => (bytes += buffer.length, output.write(buffer));
+            header.writeUInt32BE(width, 0), header.writeUInt32BE(height, 4), header[8] = 8, header[9] = 2;
+            put(encoder.signature), put(encoder.chunk('IHDR', header));
+            deflate.on('data', (data) => put(encoder.chunk('IDAT', data)));
+            deflate.on('end', () => (put(encoder.chunk('IEND')), output.end(() => resolve(bytes))));
+            deflate.on('error', reject), output.on('error', reject);
+            for (let y = 0; y < height; y += block) {
+                const rows = min(block, height - y), filtered = Buffer.allocUnsafe(rows * (stride + 1));
+                for (let r = 0; r < rows; r++)
+                    encoder.row(pixels, y + r, stride, 3, filtered, r * (stride + 1), scratch);
+                deflate.write(filtered);
+            }
+            deflate.end();
+        });
+    },
+};
+
+/** Buffers are recycled by type and length: sheets within each thread, patch inputs between the main thread and the pool. */
+const pool = {
+    free: [],
+    acquire: (length, Type = Uint8Array) => { const index = pool.free.findIndex(array => array.length === length && array instanceof Type); return index < 0 ? new Type(length) : pool.free.splice(index, 1)[0]; },
+    release: (array) => array && array.byteLength && pool.free.push(array),
+};
+
+/**
+ * Renders sheets on a fixed set of worker threads. A thread that throws or exits fails only the sheet it was rendering
+ * and is replaced; once more threads crash in a row than there are threads, the remaining sheets are failed as well.
+ */
+class SheetThreads {
+    constructor(threads = os.cpus().length, options = {}) {
+        this.options = options, this.idle = [], this.waiting = [], this.tasks = new Map(), this.lastTask = 0, this.crashes = 0;
+        this.threads = Array.from({ length: max(1, +threads) }, () => this.spawn());
+    }
+    spawn() {
+        const thread = new Worker(__filename, { workerData: { sheets: true } });
+        thread.on('message', ({ id, input, error, ...result }) => {
+            const { resolve, reject } = this.tasks.get(id);
+            this.tasks.delete(id), thread.task = undefined, this.crashes = 0, pool.release(input), this.next(thread);
+            error ? reject(Error(error)) : resolve(result);
+        });
+        thread.on('error', (exception) => this.crashed(thread, exception));
+        thread.on('exit', (code) => this.crashed(thread, Error(`Sheet thread exited with code ${code}`), code));
+        return this.idle.push(thread), thread;
+    }
+    /** Fails the crashed thread's sheet, then replaces the thread, or fails every queued sheet after too many crashes in a row. */
+    crashed(thread, exception, code) {
+        const index = this.threads.indexOf(thread);
+        if (index < 0 || (this.closing && code !== undefined)) return;
+        const task = this.tasks.get(thread.task);
+        task && (this.tasks.delete(thread.task), task.reject(exception)), thread.task = undefined;
+        if (code === undefined) return;
+        this.idle = this.idle.filter(idle => idle !== thread), this.threads.splice(index, 1);
+        if (++this.crashes <= this.threads.length + 1)
+            return this.threads.push(this.spawn()), this.next(this.idle.pop());
+        this.failure = exception;
+        for (const { id } of this.waiting.splice(0))
+            this.tasks.get(id).reject(exception), this.tasks.delete(id);
+    }
+    render(file, input) {
+        return new Promise((resolve, reject) => {
+            if (this.failure) return reject(this.failure);
+            const id = ++this.lastTask;
+            this.tasks.set(id, { resolve, reject }), this.waiting.push(Object.assign({ id, file, input }, this.options));
+            this.idle.length && this.next(this.idle.pop());
+        });
+    }
+    next(thread) {
+        const task = this.waiting.shift();
+        if (!task)
+            return this.idle.includes(thread) || this.idle.push(thread);
+        thread.task = task.id, thread.postMessage(task, [task.input.buffer]);
+    }
+    close() {
+        return this.closing = true, Promise.all(this.threads.map(thread => thread.terminate()));
+    }
+}
+
+const sheet = {
+    margin: 8, gap: 8, panels: 4, contrastConstant: 9e-3, overlay: [255, 191, 127],
+    colours: [[66, 133, 244], [219, 68, 55], [244, 180, 0], [15, 157, 88], [171, 71, 188], [0, 172, 193]],
+    layout: (size) => {
+        const strip = max(24, floor(size / 4)), width = sheet.margin * 2 + sheet.panels * size + (sheet.panels - 1) * sheet.gap;
+        return { size, strip, width, height: sheet.margin * 2 + size + sheet.gap + strip };
+    },
+    panel: (pixels, { width, size }, index, colour) => {
+        const left = sheet.margin + index * (size + sheet.gap);
+        for (let y = 0, i = 0; y < size; y++)
+            for (let x = 0, o = ((sheet.margin + y) * width + left) * 3; x < size; x++, i++, o += 3)
+                colour(i, pixels, o);
+    },
+    /** Fills a sheet from one patch's analysis; bar lengths are clamped to each scorer's range (1 unless given). */
+    compose: ({ input, output, range: [low, high] = [0, 1], magnitude, maximum, filter, scores = {} }, layout, ranges = {}) => {
+        const { width, height, size, strip } = layout, pixels = pool.acquire(width * height * 3), c = sheet.contrastConstant;
+        const denominator = log1p(c * maximum) || 1, span = high - low || 1, [r, g, b] = sheet.overlay;
+        pixels.fill(255);
+        sheet.panel(pixels, layout, 0, (i, p, o) => p[o] = p[o + 1] = p[o + 2] = input[i]);
+        sheet.panel(pixels, layout, 1, (i, p, o) => p[o] = p[o + 1] = p[o + 2] = 255 * log1p(c * magnitude[i]) / denominator);
+        sheet.panel(pixels, layout, 2, (i, p, o, v = 255 * log1p(c * magnitude[i]) / denominator, a = 0.5 * (filter[i] || 0)) =>
+            (p[o] = v + (r - v) * a, p[o + 1] = v + (g - v) * a, p[o + 2] = v + (b - v) * a));
+        sheet.panel(pixels, layout, 3, (i, p, o) => p[o] = p[o + 1] = p[o + 2] = 255 * (output[i] - low) / span);
+        const names = Object.keys(scores), top = sheet.margin + size + sheet.gap, bar = max(2, floor(strip / max(1, names.length)) - 2), length = width - sheet.margin * 2;
+        names.forEach((name, n) => {
+            const value = scores[name], extent = isFinite(value) ? floor(length * min(1, max(0, value / (ranges[name] || 1)))) : 0, colour = sheet.colours[n % sheet.colours.length];
+            for (let y = top + n * (bar + 2), end = y + bar; y < end && y < height - sheet.margin; y++)
+                for (let x = 0, o = (y * width + sheet.margin) * 3; x < length; x++, o += 3)
+                    x < extent ? (pixels[o] = colour[0], pixels[o + 1] = colour[1], pixels[o + 2] = colour[2]) : (pixels[o] = pixels[o + 1] = pixels[o + 2] = 232);
+        });
+        return pixels;
+    },
+};
+
+/** Analyses one patch on this thread's engine, composes its sheet and streams it to disk. */
+const render = ({ file, input, size, band, shape, scorers: names, level, ranges }, state = render) => {
+    if (!state.run) {
+        const { engine } = require('./shards'), { bandFilter } = require('./filters');
+        state.run = engine(), state.layout = sheet.layout(size), state.allPass = bandFilter(size), state.filter = bandFilter(size, band, shape);
+    }
+    const { run, layout, allPass, filter } = state, key = file;
+    run({ action: 'batch', key, inputs: [input] });
+    const { magnitudes: [magnitude] = [], maxima: [maximum] = [] } = run({ action: 'filterInverse', key, filter: allPass, width: size, spectra: true }) || {};
+    const { outputs: [output] = [], ranges: [range] = [], scores: values = {}, labels = {} } = run({ action: 'filterInverse', key, filter, width: size, scorers: names }) || {};
+    run({ action: 'release', key });
+    const scores = Object.keys(values).reduce((scores, name) => (scores[name] = values[name][0], scores), {});
+    const pixels = sheet.compose({ input, output, range, magnitude, maximum, filter, scores }, layout, ranges);
+    return encoder.write(file, layout.width, layout.height, pixels, { level }).then((bytes) => (pool.release(pixels), {
+        bytes, scores, labels: names.reduce((named, name) => (name in labels && (named[name] = labels[name]), named), {}),
+    }));
+};
+
+if (!isMainThread && workerData && workerData.sheets) {
+    parentPort.on('message', ({ id, ...task }) => render(task).then(
+        (result) => parentPort.postMessage(Object.assign({ id, input: task.input }, result), [task.input.buffer]),
+        (exception) => parentPort.postMessage({ id, input: task.input, error: `${exception.message || exception}` }, [task.input.buffer])));
+}
+
+const escape = (text) => `${text}`.replace(/[&<>"]/g, (c) => `&#${c.charCodeAt(0)};`);
+const index = ({ title, screenings, labels, layout }) => `<!DOCTYPE html>
+<html><head><meta charset="utf-8"><title>${escape(title)}</title>
+<style>body{font:13px/1.4 system-ui,sans-serif;margin:1em}table{border-collapse:collapse;margin-bottom:2em}td,th{padding:2px 6px;border-bottom:1px solid #ddd;text-align:right}td:first-child,th:first-child{text-align:left}img{display:block;width:${layout.width / 2}px;height:auto}</style>
+</head><body><h1>${escape(title)}</h1>
+${screenings.map(({ id, title, rows }) => `<h2>${escape(title || id)}</h2>
+<table><tr><th>Patch</th><th>Contrast</th><th>Resolution</th>${Object.values(labels).map(label => `<th>${escape(label)}</th>`).join('')}<th>Sheet</th></tr>
+${rows.map(({ src, sheet: file, contrast, resolution, scores = {}, error }) => `<tr><td>${escape(src)}</td><td>${contrast}</td><td>${resolution}</td>${Object.keys(labels).map(name => `<td>${isFinite(scores[name]) ? (+scores[name]).toFixed(3) : '–'}</td>`).join('')}<td>${error ? escape(error) : `<a href="${encodeURI(file)}"><img loading="lazy" src="${encodeURI(file)}" width="${layout.width / 2}" height="${layout.height / 2}" alt=""></a>`}</td></tr>`).join('\n')}
+</table>`).join('\n')}
+</body></html>
+`;
+
+const report = async (manifestFile, directory, { size = 256, band, screenings: only, scorers = 'contrast,energy,modulation,resolved', threads = os.cpus().length, level = 3, capacity = 8, readers = 4, ...filter } = {}) => {
+    const { formats, resample } = require('./shards'), { pipeline } = require('./pipeline');
+    const manifest = JSON.parse(fs.readFileSync(manifestFile, 'utf8')), base = path.dirname(path.resolve(manifestFile)), inflate = promisify(zlib.inflate);
+    const { shapeParameters } = require('./filters'), shape = shapeParameters(filter);
+    const sheets = new SheetThreads(threads, { size: +size, band: band ? `${band}`.split(':').map(Number) : undefined, shape, scorers: `${scorers}`.split(','), level: +level, ranges: { resolved: size / 8 } });
+    const selected = manifest.screenings.filter(({ id }) => !only || `${only}`.split(',').includes(id));
+    const entries = [].concat(...selected.map((screening) => screening.patches.map((patch) => ({ screening, patch }))));
+    const labels = {}, errors = {}, started = Date.now();
+    for (const { id } of selected)
+        fs.mkdirSync(path.join(directory, id), { recursive: true });
+    const { results, metrics } = await pipeline(entries, [
+        { name: 'read', concurrency: +readers, run: async (entry) => Object.assign(entry, { buffer: await fs.promises.readFile(path.join(base, entry.screening.base || '', entry.patch.src)) }) },
+        { name: 'inflate', concurrency: +readers, run: (entry) => formats.inflate(entry, inflate) },
+        { name: 'extract', run: (entry) => (entry.input = resample(formats.image(entry, +size), +size, pool.acquire(size * size, Uint8ClampedArray)), entry.raw = entry.header = entry.buffer = undefined, entry) },
+        {
+            name: 'sheet', concurrency: sheets.threads.length, run: async ({ screening, patch, input }) => {
+                const file = path.join(directory, screening.id, patch.src), { bytes, scores, labels: named } = await sheets.render(file, input);
+                Object.assign(labels, named);
+                return { src: patch.src, screening: screening.id, sheet: path.relative(directory, file), contrast: patch.contrast, resolution: patch.resolution, scores, bytes };
+            },
+        },
+    ], { capacity: +capacity, onError: (exception, { item: { patch } }) => errors[patch.src] = `${exception.message || exception}` });
+    await sheets.close();
+    const rows = entries.map(({ screening, patch }, i) => results[i] || { src: patch.src, screening: screening.id, contrast: patch.contrast, resolution: patch.resolution, error: errors[patch.src] || 'failed' });
+    const screenings = selected.map(({ id, title }) => ({ id, title, rows: rows.filter(row => row.screening === id) }));
+    fs.writeFileSync(path.join(directory, 'index.html'), index({ title: `${manifest.name || 'Report'} — ${size}×${size}${band ? ` band ${band}${shape.shape ? ` ${shape.shape}` : ''}` : ''}`, screenings, labels, layout: sheet.layout(+size) }));
+    fs.writeFileSync(path.join(directory, 'report.json'), JSON.stringify({ size: +size, band, shape, labels, elapsed: Date.now() - started, metrics, screenings }, null, 1));
+    return { patches: rows.length, elapsed: Date.now() - started, metrics };
+};
+
+module.exports = { encoder, pool, SheetThreads, sheet, render, report };
+
+if (isMainThread && require.main === module) {
+    const args = process.argv.slice(2), positional = [], options = {};
+    for (let i = 0; i < args.length; i++)
+        args[i].startsWith('--') ? (options[args[i].slice(2)] = args[++i]) : positional.push(args[i]);
+    const [manifestFile, directory] = positional;
+    if (!manifestFile || !directory)
+        console.error(`Usage: node report.js <manifest.json> <directory> [--size 256] [--band low:high] [--shape name] [--screenings …] [--threads n]`), process.exit(1);
+    fs.mkdirSync(directory, { recursive: true });
+    report(manifestFile, directory, options).then(({ patches, elapsed, metrics: { stages } }) =>
+        console.log(`${patches} sheets in ${(elapsed / 1000).toFixed(1)}s — ${stages.map(({ name, utilisation }) => `${name} ${(100 * utilisation).toFixed(0)}%`).join(', ')}`),
+        (exception) => (console.error(exception), process.exit(1)));
+}
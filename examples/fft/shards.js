@@ -0,0 +1,396 @@
+// Headless batch runner: shards screening analysis across processes and hosts through a shared-directory job queue.
+//
+//   node shards.js enqueue <queue> <manifest.json> [--size 256] [--chunk 20] [--band low:high] [--shape gaussian] [--curve 0,1,0] [--scorers contrast,energy]
+//   node shards.js work <queue> [--workers <cpus>] [--memory <MiB>] [--lease 120] [--capacity 4] [--readers 4]
+//   node shards.js merge <queue> [store.json]
+//   node shards.js status <queue>
+//
+// <queue>/jobs/<id>.json      immutable job descriptions (written once by enqueue); ids carry the size and filter, e.g. fm-1200-256-10-40-003 or fm-1200-256-10-40-butterworth-4-003
+//                             PNG and SVG patches are enqueued; enqueue reports how many patches of each screening it skipped
+// <queue>/leases/<id>.json    { owner, host, pid, expires, attempts } — written by whoever wins the attempt, renewed between patches, stolen when expired
+// <queue>/attempts/<id>.<n>   created with O_EXCL by the one runner that wins attempt n at a job
+// <queue>/results/<id>.json   written to a temporary file and renamed into place, so a re-run job replaces its result atomically
+// <queue>/failed/<id>.json    jobs that exhausted their attempts
+//
+// Hosts that mount the queue share at the same path run `work` independently; there is no coordinator.
+const fs = require('fs'), path = require('path'), os = require('os'), vm = require('vm'), zlib = require('zlib'), { fork } = require('child_process'), { promisify } = require('util');
+const { pipeline } = require('./pipeline'), { bandFilter, shapeParameters } = require('./filters');
+
+const { floor, round, min, max, abs } = Math;
+const hostname = os.hostname(), owner = `${hostname}:${process.pid}`;
+const settings = { size: 256, chunk: 20, lease: 120, grace: 5, attempts: 3, workers: os.cpus().length, scorers: undefined, band: undefined, capacity: 4, readers: 4 };
+
+const parseArguments = (args, options = {}) => {
+    const positional = [];
+    for (let i = 0; i < args.length; i++)
+        args[i].startsWith('--') ? (options[args[i].slice(2)] = args[++i]) : positional.push(args[i]);
+    return { positional, options };
+};
+
+const png = {
+    signature: Buffer.from([137, 80, 78, 71, 13, 10, 26, 10]),
+    channels: { 0: 1, 2: 3, 3: 1, 4: 2, 6: 4 },
+    /** Decodes a non-interlaced 8/16-bit PNG into its first channel (the same channel the wall reads from the canvas). */
+    decode(buffer) {
+        const header = png.parse(buffer);
+        return png.unfilter(header, zlib.inflateSync(header.compressed));
+    },
+    /** Reads the header and concatenated image data; inflating is left to the caller so it can run off the main thread. */
+    parse(buffer) {
+        if (!buffer.slice(0, 8).equals(png.signature)) throw Error(`Not a PNG image`);
+        let width, height, depth, type, interlace, palette;
+        const chunks = [];
+        for (let offset = 8, length, name; offset < buffer.length; offset += length + 12) {
+            length = buffer.readUInt32BE(offset), name = buffer.toString('latin1', offset + 4, offset + 8);
+            const data = buffer.slice(offset + 8, offset + 8 + length);
+            if (name === 'IHDR') width = data.readUInt32BE(0), height = data.readUInt32BE(4), depth = data[8], type = data[9], interlace = data[12];
+            else if (name === 'PLTE') palette = data;
+            else if (name === 'IDAT') chunks.push(data);
+            else if (name === 'IEND') break;
+        }
+        if (interlace || (depth !== 8 && depth !== 16) || !(type in png.channels)) throw Error(`Unsupported PNG (depth ${depth}, type ${type}, interlace ${interlace})`);
+        return { width, height, depth, type, palette, compressed: Buffer.concat(chunks) };
+    },
+    unfilter({ width, height, depth, type, palette }, raw) {
+        const bpp = png.channels[type] * depth / 8, stride = width * bpp;
+        const pixels = Buffer.alloc(stride * height), output = new Uint8ClampedArray(width * height);
+        for (let y = 0, previous = Buffer.alloc(stride); y < height; y++) {
+            const filter = raw[y * (stride + 1)], line = raw.slice(y * (stride + 1) + 1, (y + 1) * (stride + 1)), current = pixels.slice(y * stride, (y + 1) * stride);
+            for (let x = 0, a, b, c, p; x < stride; x++) {
+                a = x >= bpp ? current[x - bpp] : 0, b = previous[x], c = x >= bpp ? previous[x - bpp] : 0;
+                p = filter === 1 ? a : filter === 2 ? b : filter === 3 ? (a + b) >> 1 : filter === 4 ? png.paeth(a, b, c) : 0;
+                current[x] = (line[x] + p) & 255;
+            }
+            previous = current;
+        }
+        for (let i = 0, v; i < output.length; i++)
+            v = pixels[i * bpp], output[i] = palette ? palette[v * 3] : v;
+        return { width, height, data: output };
+    },
+    paeth(a, b, c, p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c)) {
+        return pa <= pb && pa <= pc ? a : pb <= pc ? b : c;
+    },
+};
+
+/**
+ * Rasterises the flat SVG patches of the vector screening (filled paths, circles, polygons and rects in document order)
+ * into their first channel, on the transparent-black background the wall's cleared canvas gives them.
+ */
+const svg = {
+    number: /[-+]?(?:\d+\.?\d*|\.\d+)(?:e[-+]?\d+)?/gi,
+    attribute: (tag, name) => (tag.match(new RegExp(`\\s${name}="([^"]*)"`)) || [])[1],
+    /** The first (red) channel of a #rgb/#rrggbb fill; black when unset, undefined for none. */
+    fill(value = '#000') {
+        if (value === 'none') return;
+        const hex = value.replace(/^#/, '');
+        if (!/^[\da-f]{3}$|^[\da-f]{6}$/i.test(hex)) throw Error(`Unsupported SVG fill ${value}`);
+        return parseInt(hex.length === 3 ? hex[0] + hex[0] : hex.slice(0, 2), 16);
+    },
+    /** Flattens path data into closed polygons; cubic segments are split by their control polygon's length. */
+    path(d, scale) {
+        const tokens = d.match(/[a-z]|[-+]?(?:\d+\.?\d*|\.\d+)(?:e[-+]?\d+)?/gi) || [], polygons = [];
+        let polygon, command, x = 0, y = 0, sx = 0, sy = 0, cx, cy, i = 0;
+        const take = () => +tokens[i++], to = (px, py) => (x = px, y = py, polygon.push(x, y));
+        const cubic = (x1, y1, x2, y2, x3, y3) => {
+            const steps = max(2, min(64, Math.ceil((Math.hypot(x1 - x, y1 - y) + Math.hypot(x2 - x1, y2 - y1) + Math.hypot(x3 - x2, y3 - y2)) * scale / 2)));
+            for (let s = 1, x0 = x, y0 = y, t, u; s <= steps; s++)
+                t = s / steps, u = 1 - t, polygon.push(u * u * u * x0 + 3 * u * u * t * x1 + 3 * u * t * t * x2 + t * t * t * x3, u * u * u * y0 + 3 * u * u * t * y1 + 3 * u * t * t * y2 + t * t * t * y3);
+            cx = x2, cy = y2, x = x3, y = y3;
+        };
+        while (i < tokens.length) {
+            /[a-z]/i.test(tokens[i]) ? (command = tokens[i++]) : command === 'M' ? (command = 'L') : command === 'm' && (command = 'l');
+            const relative = command === command.toLowerCase(), ox = relative ? x : 0, oy = relative ? y : 0, upper = command.toUpperCase();
+            if (upper !== 'C' && upper !== 'S') cx = cy = undefined;
+            if (upper === 'M') polygons.push(polygon = []), to(ox + take(), oy + take()), sx = x, sy = y;
+            else if (upper === 'Z') polygon.length && (x = sx, y = sy);
+            else if (!polygon) throw Error(`SVG path data must start with a moveto`);
+            else if (upper === 'L') to(ox + take(), oy + take());
+            else if (upper === 'H') to(ox + take(), y);
+            else if (upper === 'V') to(x, oy + take());
+            else if (upper === 'C') cubic(ox + take(), oy + take(), ox + take(), oy + take(), ox + take(), oy + take());
+            else if (upper === 'S') cubic(cx === undefined ? x : 2 * x - cx, cy === undefined ? y : 2 * y - cy, ox + take(), oy + take(), ox + take(), oy + take());
+            else throw Error(`Unsupported SVG path command ${command}`);
+        }
+        return polygons;
+    },
+    circle(cx, cy, r, scale, steps = max(16, min(512, Math.ceil(2 * Math.PI * r * scale / 2)))) {
+        return [Array.from({ length: steps * 2 }, (_, i) => (i & 1 ? cy + r * Math.sin(Math.PI * 2 * (i >> 1) / steps) : cx + r * Math.cos(Math.PI * 2 * (i >> 1) / steps)))];
+    },
+    /** Adds the nonzero-winding coverage of polygons to `coverage` with 4 sub-scanlines per row (over an active edge list) and exact horizontal span ends. */
+    cover(polygons, width, height, scale, [ox, oy], coverage) {
+        const edges = [], samples = 4;
+        for (const points of polygons)
+            for (let i = 0, n = points.length; i < n; i += 2) {
+                const x0 = (points[i] - ox) * scale, y0 = (points[i + 1] - oy) * scale, x1 = (points[(i + 2) % n] - ox) * scale, y1 = (points[(i + 3) % n] - oy) * scale;
+                y0 !== y1 && edges.push(y0 < y1 ? [y0, y1, x0, (x1 - x0) / (y1 - y0), 1] : [y1, y0, x1, (x0 - x1) / (y0 - y1), -1]);
+            }
+        if (!edges.length) return [0, 0];
+        edges.sort((a, b) => a[0] - b[0]);
+        const top = max(0, floor(edges[0][0])), bottom = min(height, Math.ceil(edges.reduce((bottom, edge) => max(bottom, edge[1]), 0)));
+        for (let row = top, next = 0, active = [], crossings = []; row < bottom; row++)
+            for (let s = 0; s < samples; s++) {
+                const sy = row + (s + 0.5) / samples;
+                while (next < edges.length && edges[next][0] <= sy) active.push(edges[next++]);
+                active = active.filter(edge => edge[1] > sy), crossings.length = 0;
+                for (const [y0, , x0, slope, direction] of active)
+                    crossings.push([x0 + (sy - y0) * slope, direction]);
+                crossings.sort((a, b) => a[0] - b[0]);
+                for (let c = 0, winding = 0; c < crossings.length - 1; c++)
+                    if (winding += crossings[c][1]) {
+                        const left = max(0, crossings[c][0]), right = min(width, crossings[c + 1][0]);
+                        for (let px = floor(left), base = row * width; px < right; px++)
+                            coverage[base + px] += (min(px + 1, right) - max(px, left)) / samples;
+                    }
+            }
+        return [top, bottom];
+    },
+    /** Decodes an SVG patch at `size` pixels on its shorter side. */
+    decode(buffer, size = 1024) {
+        const text = buffer.toString('utf8'), root = (text.match(/<svg\b[^>]*>/) || [])[0];
+        if (!root) throw Error(`Not an SVG image`);
+        const [ox, oy, w, h] = (svg.attribute(root, 'viewBox') || `0 0 ${parseFloat(svg.attribute(root, 'width'))} ${parseFloat(svg.attribute(root, 'height'))}`).match(svg.number).map(Number);
+        if (!(w > 0 && h > 0)) throw Error(`SVG image without a viewBox or size`);
+        const scale = size / min(w, h), width = Math.round(w * scale), height = Math.round(h * scale);
+        const data = new Uint8ClampedArray(width * height), coverage = new Float32Array(width * height);
+        for (const [tag, name] of text.replace(/<(defs|clipPath|mask|pattern|symbol)\b[\s\S]*?<\/\1>/g, '').matchAll(/<(path|circle|polygon|rect)\b[^>]*>/g)) {
+            const value = svg.fill(svg.attribute(tag, 'fill')), get = (attribute) => +svg.attribute(tag, attribute) || 0;
+            if (value === undefined) continue;
+            if (/\stransform=/.test(tag)) throw Error(`Unsupported SVG transform on <${name}>`);
+            const polygons = name === 'path' ? svg.path(svg.attribute(tag, 'd') || '', scale)
+                : name === 'circle' ? svg.circle(get('cx'), get('cy'), get('r'), scale)
+                    : name === 'polygon' ? [(svg.attribute(tag, 'points') || '').match(svg.number).map(Number)]
+                        : [[get('x'), get('y'), get('x') + get('width'), get('y'), get('x') + get('width'), get('y') + get('height'), get('x'), get('y') + get('height')]];
+            const [top, bottom] = svg.cover(polygons.filter(points => points.length >= 6), width, height, scale, [ox, oy], coverage);
+            for (let i = top * width, end = bottom * width, a; i < end; i++)
+                (a = min(1, coverage[i])) && (data[i] = data[i] * (1 - a) + value * a, coverage[i] = 0);
+        }
+        return { width, height, data };
+    },
+};
+
+/** Patch formats the headless runners decode: PNGs are inflated on the libuv pool, SVGs rasterised in the extract stage. */
+const formats = {
+    supported: (src) => /\.(png|svg)$/i.test(src),
+    /** The inflate stage: parses a PNG and inflates its data; SVGs pass through, anything else fails the patch. */
+    inflate: async (entry, inflate) => {
+        if (/\.svg$/i.test(entry.patch.src)) return entry;
+        if (!formats.supported(entry.patch.src)) throw Error(`Unsupported patch format ${path.extname(entry.patch.src) || entry.patch.src}`);
+        return entry.header = png.parse(entry.buffer), entry.raw = await inflate(entry.header.compressed), entry.buffer = undefined, entry;
+    },
+    /** The extract stage's decoded image: the unfiltered PNG, or the SVG rasterised at the analysis size. */
+    image: (entry, size) => entry.header ? png.unfilter(entry.header, entry.raw) : svg.decode(entry.buffer, size),
+};
+
+/** Cover-fits and centres an image into a size × size (or [columns, rows]) input, like the wall does with drawImage. */
+const resample = ({ width, height, data }, size, output) => {
+    const [columns, rows] = Array.isArray(size) ? size : [size, size];
+    output = output || new Uint8ClampedArray(columns * rows);
+    const scale = max(columns / width, rows / height), ox = (columns - width * scale) / 2, oy = (rows - height * scale) / 2;
+    for (let y = 0, k = 0; y < rows; y++)
+        for (let x = 0, sy = min(height - 1, max(0, (y + 0.5 - oy) / scale - 0.5)), y0 = floor(sy), y1 = min(height - 1, y0 + 1), fy = sy - y0; x < columns; x++, k++) {
+            const sx = min(width - 1, max(0, (x + 0.5 - ox) / scale - 0.5)), x0 = floor(sx), x1 = min(width - 1, x0 + 1), fx = sx - x0;
+            output[k] = (data[y0 * width + x0] * (1 - fx) + data[y0 * width + x1] * fx) * (1 - fy) + (data[y1 * width + x0] * (1 - fx) + data[y1 * width + x1] * fx) * fy;
+        }
+    return output;
+};
+
+/** Loads workers/fft.js into its own context and drives it synchronously through its message handler. */
+const engine = (file = path.join(__dirname, 'workers', 'fft.js')) => {
+    let reply;
+    const self = { postMessage: (message) => (reply = message) };
+    const context = vm.createContext({
+        self, console, performance: require('perf_hooks').performance, WebAssembly, SharedArrayBuffer, setTimeout, clearTimeout,
+        Math, Map, Set, Object, Array, Error, Function, Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array, Int32Array, Uint32Array, Float32Array, Float64Array,
+    });
+    vm.runInContext(fs.readFileSync(file, 'utf8'), context, { filename: file });
+    return (data) => (reply = undefined, self.onmessage({ data }), reply);
+};
+
+const queue = {
+    directories: (root) => ['jobs', 'leases', 'attempts', 'results', 'failed'].reduce((directories, name) => (directories[name] = path.join(root, name), directories), {}),
+    prepare: (root) => Object.values(queue.directories(root)).forEach(directory => fs.mkdirSync(directory, { recursive: true })),
+    read: (file) => { try { return JSON.parse(fs.readFileSync(file, 'utf8')); } catch (exception) { return undefined; } },
+    /** Writes through a uniquely named temporary file and renames it into place, which is atomic on the same filesystem. */
+    write: (file, value) => {
+        const temporary = `${file}.${owner.replace(/\W/g, '-')}.tmp`;
+        fs.writeFileSync(temporary, JSON.stringify(value, null, 1)), fs.renameSync(temporary, file);
+    },
+    ids: (root) => fs.readdirSync(queue.directories(root).jobs).filter(name => name.endsWith('.json')).map(name => name.slice(0, -5)).sort(),
+    lease: (root, id, { lease = settings.lease, attempts = 0 } = {}) => ({ owner, host: hostname, pid: process.pid, duration: +lease, expires: Date.now() + lease * 1000, attempts }),
+    /** Creates the marker for one attempt at a job with O_EXCL; of several runners racing for the same attempt exactly one succeeds. */
+    attempt: (root, id, attempts) => {
+        try { return fs.closeSync(fs.openSync(path.join(queue.directories(root).attempts, `${id}.${attempts}`), 'wx')), true; }
+        catch (exception) { if (exception.code !== 'EEXIST') throw exception; return false; }
+    },
+    /** The latest attempt marker of a job, which stands in for a lease its winner has not written yet (or died before writing). */
+    latest: (root, id) => fs.readdirSync(queue.directories(root).attempts).filter(name => name.startsWith(`${id}.`)).reduce((latest, name) => {
+        const attempts = +name.slice(id.length + 1);
+        return attempts > latest.attempts ? { attempts, started: fs.statSync(path.join(queue.directories(root).attempts, name)).mtimeMs } : latest;
+    }, { attempts: 0, started: 0 }),
+    /**
+     * Claims a job when it has no live lease. Every claim, first or stolen, must win the exclusive marker of the next
+     * attempt, so only one runner can take over a given lease and the attempts count never restarts. The lease file
+     * itself is only ever replaced by rename, never removed while the job runs; a lease must be expired by settings.grace
+     * seconds before it is stolen, which keeps a steal from crossing a renewal made just before expiry.
+     */
+    claim: (root, id, options = {}) => {
+        const { leases, results, failed } = queue.directories(root), file = path.join(leases, `${id}.json`);
+        if (fs.existsSync(path.join(results, `${id}.json`)) || fs.existsSync(path.join(failed, `${id}.json`))) return;
+        const duration = +(options.lease || settings.lease) * 1000, current = queue.read(file), latest = queue.latest(root, id);
+        const expires = current && current.attempts >= latest.attempts ? current.expires : latest.started && latest.started + duration;
+        if (expires && expires + settings.grace * 1000 > Date.now()) return;
+        const attempts = max(latest.attempts, (current && current.attempts) || 0) + 1;
+        if (!queue.attempt(root, id, attempts)) return;
+        if (attempts > (options.attempts || settings.attempts))
+            return queue.write(path.join(failed, `${id}.json`), Object.assign({ id, failed: Date.now() }, current)), undefined;
+        const lease = queue.lease(root, id, Object.assign({}, options, { attempts }));
+        return queue.write(file, lease), lease;
+    },
+    /** Extends this runner's own live lease by replacing it; returns false once the lease has expired or been taken over. */
+    renew: (root, id, lease) => {
+        const file = path.join(queue.directories(root).leases, `${id}.json`), current = queue.read(file);
+        if (!current || current.owner !== owner || current.attempts !== lease.attempts || current.expires <= Date.now()) return false;
+        return queue.write(file, Object.assign(lease, { expires: Date.now() + lease.duration * 1000 })), true;
+    },
+    complete: (root, id, result) => {
+        const { leases, attempts, results } = queue.directories(root);
+        queue.write(path.join(results, `${id}.json`), result);
+        try { fs.unlinkSync(path.join(leases, `${id}.json`)); } catch (exception) { }
+        for (const name of fs.readdirSync(attempts).filter(name => name.startsWith(`${id}.`)))
+            try { fs.unlinkSync(path.join(attempts, name)); } catch (exception) { }
+    },
+};
+
+/** Names a filter for ids and keys: the band, followed by the shape and its parameters when they are not the default Gaussian. */
+const filterName = (band, shape = {}) => band ? [band.join('-'), ...Object.values(shapeParameters(shape)).map(value => `${value}`.replace(/[^\w.]+/g, '_'))].join('-') : '';
+
+/** Identifies a patch's analysis by screening, size and filter, so runs of the same patches with other parameters sit side by side. */
+const patchKey = ({ screening, size, band, shape }, src) => `${screening}/${size}${band ? `/${filterName(band, shape)}` : ''}/${src}`;
+
+const enqueue = (root, manifestFile, { size = settings.size, chunk = settings.chunk, band, scorers, ...options } = {}) => {
+    queue.prepare(root);
+    const manifest = queue.read(manifestFile), base = path.dirname(path.resolve(manifestFile)), { jobs } = queue.directories(root);
+    if (!manifest || !manifest.screenings) throw Error(`Cannot read screenings from ${manifestFile}`);
+    const bands = band ? `${band}`.split(':').map(Number) : undefined, shape = bands && Object.keys(shapeParameters(options)).length ? shapeParameters(options) : undefined;
+    let count = 0;
+    for (const screening of manifest.screenings) {
+        const patches = screening.patches.filter(({ src }) => formats.supported(src)), skipped = screening.patches.length - patches.length;
+        skipped && console.warn(`Skipped ${skipped} of ${screening.patches.length} patches in ${screening.id}: only PNG and SVG patches can be decoded headless`);
+        for (let offset = 0; offset < patches.length; offset += +chunk) {
+            const id = `${screening.id}-${size}${bands ? `-${filterName(bands, shape)}` : ''}-${String(offset / chunk).padStart(3, '0')}`, file = path.join(jobs, `${id}.json`);
+            if (fs.existsSync(file)) continue;
+            queue.write(file, {
+                id, screening: screening.id, title: screening.title, size: +size, band: bands, shape,
+                scorers: scorers ? `${scorers}`.split(',') : undefined, viewing: { patchSize: manifest.patchSize },
+                base: path.relative(path.resolve(root), path.join(base, screening.base || '')), patches: patches.slice(offset, offset + +chunk),
+            }), count++;
+        }
+    }
+    return count;
+};
+
+/**
+ * Streams one job's patches through read → inflate → extract → fft → score, so a patch is transformed while later
+ * ones are still being read and inflated (file reads and inflate run on the libuv pool). The lease is renewed as
+ * each patch completes so long jobs are not stolen; once a renewal fails the job is abandoned without a result.
+ */
+const analyse = async (root, job, lease, run = engine(), { capacity = settings.capacity, readers = settings.readers } = {}) => {
+    const started = Date.now(), { size, patches } = job, base = path.resolve(root, job.base), errors = {}, labels = {};
+    const filter = bandFilter(size, job.band, job.shape), inflate = promisify(zlib.inflate), lost = new AbortController();
+    const { results, metrics, aborted } = await pipeline(patches.map((patch, index) => ({ patch, index })), [
+        { name: 'read', concurrency: +readers, run: async (entry) => Object.assign(entry, { buffer: await fs.promises.readFile(path.join(base, entry.patch.src)) }) },
+        { name: 'inflate', concurrency: +readers, run: (entry) => formats.inflate(entry, inflate) },
+        { name: 'extract', run: (entry) => (entry.input = resample(formats.image(entry, size), size), entry.raw = entry.header = entry.buffer = undefined, entry) },
+        { name: 'fft', run: (entry) => (run({ action: 'batch', key: entry.key = `${job.id} ${entry.index}`, inputs: [entry.input] }), entry) },
+        {
+            name: 'score', run: ({ key, index }) => {
+                const { scores = {}, labels: names = {} } = run({ action: 'score', key, width: size, filter, scorers: job.scorers }) || {};
+                const [measurement = {}] = (run({ action: 'calibrate', key, width: size }) || {}).measurements || [];
+                run({ action: 'release', key }), Object.assign(labels, names);
+                return { index, radius: measurement.radius, prominence: measurement.prominence, scores: Object.keys(scores).reduce((values, name) => (values[name] = scores[name][0], values), {}) };
+            },
+        },
+    ], {
+        capacity: +capacity,
+        onError: (exception, { item: { patch } }) => errors[patch.src] = `${exception.message || exception}`,
+        onResult: () => queue.renew(root, job.id, lease) || lost.abort(),
+        signal: lost.signal,
+    });
+    if (aborted) {
+        patches.forEach((patch, index) => run({ action: 'release', key: `${job.id} ${index}` }));
+        throw Error(`Lost the lease on ${job.id} (attempt ${lease.attempts}); leaving it to its new owner`);
+    }
+    return {
+        id: job.id, screening: job.screening, size, band: job.band, shape: job.shape, labels, host: hostname, owner, attempts: lease.attempts, started, elapsed: Date.now() - started, metrics,
+        patches: patches.map((patch, index) => Object.assign({}, patch, { key: patchKey(job, patch.src), error: errors[patch.src] }, results[index] && {
+            scores: results[index].scores, radius: results[index].radius, prominence: results[index].prominence,
+        })),
+    };
+};
+
+const work = async (root, options = {}) => {
+    queue.prepare(root);
+    const run = engine();
+    let completed = 0;
+    for (let claimed = true; claimed;) {
+        claimed = false;
+        for (const id of queue.ids(root)) {
+            const lease = queue.claim(root, id, options);
+            if (!lease) continue;
+            claimed = true;
+            try { queue.complete(root, id, await analyse(root, queue.read(path.join(queue.directories(root).jobs, `${id}.json`)), lease, run, options)), completed++; }
+            catch (exception) { console.warn(`[${owner}] ${id}: ${exception.message || exception}`); }
+        }
+    }
+    return completed;
+};
+
+/** Estimated peak bytes of one runner: the engine and its tables, plus every patch its pipeline can hold in flight. */
+const footprint = ({ size = settings.size, capacity = settings.capacity, readers = settings.readers } = {}) =>
+    64 * 2 ** 20 + (5 * capacity + 2 * readers) * size * size * (1 + 4 + 8 + 8 + 16);
+
+/**
+ * Forks one single-threaded runner per worker; every runner competes for leases independently. The number of runners
+ * is capped so their estimated footprint for the largest queued job stays within --memory (MiB, default half of free RAM).
+ */
+const spawn = (root, { workers = settings.workers, lease = settings.lease, capacity = settings.capacity, readers = settings.readers, memory = os.freemem() / 2 ** 21 } = {}) => {
+    const { jobs } = queue.directories(root), size = queue.ids(root).reduce((size, id) => max(size, (queue.read(path.join(jobs, `${id}.json`)) || {}).size || 0), 0) || settings.size;
+    const admitted = max(1, min(+workers, floor(memory * 2 ** 20 / footprint({ size, capacity: +capacity, readers: +readers }))));
+    admitted < workers && console.warn(`Running ${admitted} of ${workers} runners within ${round(memory)} MiB for ${size}×${size} jobs`);
+    return Promise.all(Array.from({ length: admitted }, () => new Promise((resolve) => {
+        const child = fork(__filename, ['work', root, '--workers', '0', '--lease', `${lease}`, '--capacity', `${capacity}`, '--readers', `${readers}`]);
+        child.on('exit', resolve);
+    })));
+};
+
+/** Folds results into a store keyed by patch, size and band, so merging the same results again (or from another host) leaves it unchanged. */
+const merge = (root, storeFile = path.join(root, 'store.json')) => {
+    const store = queue.read(storeFile) || { patches: {}, jobs: {} }, { results } = queue.directories(root);
+    for (const name of fs.readdirSync(results).filter(name => name.endsWith('.json'))) {
+        const result = queue.read(path.join(results, name));
+        if (!result) continue;
+        const { patches, ...job } = result;
+        store.jobs[result.id] = job;
+        for (const patch of patches) store.patches[patchKey(result, patch.src)] = Object.assign({ job: result.id }, patch, { key: patchKey(result, patch.src) });
+    }
+    return queue.write(storeFile, store), store;
+};
+
+const status = (root) => {
+    const { leases, results, failed } = queue.directories(root), count = (directory) => fs.readdirSync(directory).filter(name => name.endsWith('.json')).length;
+    const active = fs.readdirSync(leases).filter(name => name.endsWith('.json')).map(name => queue.read(path.join(leases, name))).filter(lease => lease && lease.expires > Date.now());
+    return { jobs: queue.ids(root).length, leased: active.length, completed: count(results), failed: count(failed), owners: [...new Set(active.map(({ owner }) => owner))] };
+};
+
+module.exports = { png, svg, formats, resample, bandFilter, engine, queue, patchKey, enqueue, analyse, work, footprint, spawn, merge, status };
+
+if (require.main === module) {
+    const [command, root, ...rest] = process.argv.slice(2), { positional, options } = parseArguments(rest);
+    if (!root) console.error(`Usage: node shards.js (enqueue|work|merge|status) <queue> …`), process.exit(1);
+    else if (command === 'enqueue') console.log(`Enqueued ${enqueue(root, positional[0], options)} jobs in ${root}`);
+    else if (command === 'work' && +(options.workers || settings.workers) > 0) spawn(root, options).then(() => console.log(status(root)));
+    else if (command === 'work') work(root, options).then(completed => console.log(`[${owner}] completed ${completed} jobs`));
+    else if (command === 'merge') console.log(`Merged ${Object.keys(merge(root, positional[0]).patches).length} patches`);
+    else if (command === 'status') console.log(status(root));
+    else console.error(`Unknown command ${command}`), process.exit(1);
+}
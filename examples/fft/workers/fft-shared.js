@@ -0,0 +1,141 @@
+"use strict";
+// SharedWorker host for the FFT engine: one engine per size serves every page of the origin over MessagePorts.
+//
+// Pages post { size, message } and receive { size, data }. Request uids are rewritten per port so replies are routed
+// back to the page that asked, even when several pages use the same uid scheme. Keys are rewritten the same way: a
+// batch is held under the fingerprint of its inputs, so pages that load the same screening share its spectra and a
+// `batch` the engine already holds is acknowledged without transforming again, while every other key a page supplies
+// (convolution kernels, say) is prefixed with its port. Replies carry the page's own key. `release` only reaches the
+// engine once every page holding that key has released it (or disconnected).
+//
+// Pages number their posts; replies carry the number back so the page can forget it. A post this host cannot
+// deserialise (a SharedArrayBuffer view from another agent cluster, say) arrives as a messageerror without any data,
+// so the host answers { failed: <number>, error } and the page fails the request it remembers under that number.
+var FFTHost;
+(function (FFTHost) {
+    FFTHost.engineURL = './fft.js';
+    FFTHost.limit = 2; // mirrors batches.limit in fft.js, which evicts the oldest key beyond it
+    const ports = new Map(), engines = {}, pending = new Map();
+    let lastPort = 0, inline, inlineResident;
+    FFTHost.transferables = (value, depth = 3, found = new Set()) => {
+        if (!value || typeof value !== 'object' || depth < 0)
+            return [...found];
+        if (ArrayBuffer.isView(value))
+            return value.buffer instanceof ArrayBuffer && found.add(value.buffer), [...found];
+        for (const key in value)
+            FFTHost.transferables(value[key], depth - 1, found);
+        return [...found];
+    };
+    /** FNV-1a over the batch inputs, so pages that load the same screening at the same size share its spectra. */
+    FFTHost.fingerprint = (inputs = []) => {
+        let hash = 0x811c9dc5;
+        for (const input of inputs) {
+            const bytes = input && new Uint8Array(input.buffer, input.byteOffset, input.byteLength);
+            for (let i = 0, length = bytes ? bytes.length : 0; i < length; i++)
+                hash = Math.imul(hash ^ bytes[i], 16777619);
+            hash = Math.imul(hash ^ (bytes ? bytes.length : 0), 16777619);
+        }
+        return `${inputs.length}:${(hash >>> 0).toString(36)}`;
+    };
+    const deliver = (data) => {
+        const route = data && pending.get(data.uid);
+        if (!route)
+            return;
+        pending.delete(data.uid), data.uid = route.uid;
+        data.key === undefined || route.key === undefined || (data.key = route.key);
+        const port = ports.get(route.port);
+        port && port.postMessage({ size: route.size, data, sequence: route.sequence }, FFTHost.transferables(data));
+    };
+    /** Runs the engine in this scope when nested workers are unavailable; fft.js keeps one set of caches for all sizes. */
+    const inlineEngine = () => {
+        if (inline)
+            return inline;
+        self.postMessage = (data) => deliver(data);
+        importScripts(FFTHost.engineURL);
+        const handler = self.onmessage;
+        self.onmessage = null;
+        return inline = (data) => handler({ data });
+    };
+    FFTHost.engine = (size) => {
+        if (engines[size])
+            return engines[size];
+        const engine = engines[size] = { size, resident: new Map(), scorers: new Map() };
+        if (typeof Worker !== 'undefined')
+            try {
+                const worker = engine.worker = new Worker(FFTHost.engineURL);
+                worker.onmessage = ({ data }) => deliver(data);
+                engine.post = (message, transfer) => worker.postMessage(message, transfer);
+                return engine;
+            }
+            catch (exception) {
+                console.warn(exception);
+            }
+        engine.post = (message) => inlineEngine()(message), engine.resident = inlineResident || (inlineResident = engine.resident);
+        return engine;
+    };
+    const release = (engine, key, portId) => {
+        const entry = engine.resident.get(key);
+        if (!entry || !entry.holders.delete(portId) || entry.holders.size)
+            return;
+        engine.resident.delete(key), engine.post({ action: 'release', key });
+    };
+    /** The engine's key for a key this page supplied: the batch fingerprint it was bound to, or the key under its port. */
+    const scope = (port, size, key) => port.keys.get(`${size}/${key}`) || `${port.id}/${key}`;
+    const hold = (engine, key, portId, kind) => {
+        const entry = engine.resident.get(key);
+        return entry ? (entry.holders.add(portId), false) : (engine.resident.set(key, { kind, holders: new Set([portId]) }), true);
+    };
+    const batch = (engine, port, message, reply) => {
+        const { key, inputs } = message, scoped = `${engine.size}/${key}`, held = `batch:${FFTHost.fingerprint(inputs)}`;
+        const previous = port.keys.get(scoped);
+        previous && previous !== held && release(engine, previous, port.id);
+        port.keys.set(scoped, held), message.key = held;
+        if (!hold(engine, held, port.id, 'batch'))
+            return reply({ uid: message.uid, action: 'batch', key, count: inputs.length, shared: true });
+        const batches = [...engine.resident].filter(([, entry]) => entry.kind === 'batch');
+        for (const [resident] of batches.slice(0, Math.max(0, batches.length - FFTHost.limit)))
+            engine.resident.delete(resident);
+        return false;
+    };
+    FFTHost.disconnect = (port) => {
+        for (const size in engines)
+            for (const key of [...engines[size].resident.keys()])
+                release(engines[size], key, port.id);
+        for (const [uid, route] of pending)
+            route.port === port.id && pending.delete(uid);
+        ports.delete(port.id);
+    };
+    FFTHost.receive = (port, { size, message, sequence } = {}) => {
+        if (!message || !(size > 0))
+            return;
+        const engine = FFTHost.engine(size), { action, uid, key } = message;
+        const reply = (data) => (port.postMessage({ size, data, sequence }, FFTHost.transferables(data)), true);
+        if (action === 'batch' && batch(engine, port, message, reply))
+            return;
+        if (action === 'release') {
+            const held = scope(port, size, key);
+            return port.keys.delete(`${size}/${key}`), release(engine, held, port.id);
+        }
+        if (key !== undefined && action !== 'batch')
+            message.key = scope(port, size, key), action === 'convolve' && hold(engine, message.key, port.id, 'convolve');
+        if (action === 'scorer') {
+            const source = engine.scorers.get(message.name);
+            if (source === message.source)
+                return uid !== undefined && reply({ uid, action, name: message.name, defined: true });
+            engine.scorers.set(message.name, message.source);
+        }
+        if (uid !== undefined) {
+            message.uid = `${port.id}/${uid}`;
+            action !== 'abort' && pending.set(message.uid, { port: port.id, uid, size, sequence, key });
+        }
+        engine.post(message, FFTHost.transferables(message));
+    };
+    self.onconnect = (event) => {
+        const port = event.ports[0], id = ++lastPort;
+        port.id = id, ports.set(id, port);
+        port.received = 0, port.keys = new Map();
+        port.onmessage = ({ data = {} }) => (port.received = data.sequence || port.received + 1, data.action === 'disconnect' ? FFTHost.disconnect(port) : FFTHost.receive(port, data));
+        port.onmessageerror = () => port.postMessage({ failed: ++port.received, error: 'The shared FFT host could not deserialise this request; SharedArrayBuffer views cannot cross into a SharedWorker' });
+        port.start && port.start();
+    };
+})(FFTHost || (FFTHost = {}));
@@ -17,6 +17,34 @@ var FFT;
     const mround = (v, m, t = trunc(v * m) / m) => v === t ? t : v >= 0 ? (v - t < 0.5 ? t : t + 1) : (t - v < 0.5 ? t : t - 1);
     const diagonal = (a, b = a) => ceil(hypot(a, b));
     const now = typeof performance !== 'undefined' && performance.now ? performance.now.bind(performance) : Date.now.bind(Date);
+    const timeOrigin = typeof performance !== 'undefined' && performance.timeOrigin || 0;
+    const timestamp = () => timeOrigin + now();
+    let stats;
+    (function (stats) {
+        stats.bounds = [0.25, 0.5, 1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048, 4096, Infinity];
+        stats.phases = ['queue', 'compute', 'transfer'];
+        let actions = {}, caches = {}, since = timestamp();
+        const histogram = () => ({ count: 0, total: 0, min: Infinity, max: -Infinity, buckets: stats.bounds.map(() => 0) });
+        stats.action = (action) => actions[action] || (actions[action] = stats.phases.reduce((counters, phase) => (counters[phase] = histogram(), counters), { count: 0, aborted: 0 }));
+        stats.record = (action, phase, elapsed) => {
+            if (!(elapsed >= 0))
+                return;
+            const { [phase]: entry } = stats.action(action), { bounds } = stats;
+            let i = 0;
+            while (elapsed > bounds[i])
+                i++;
+            entry.count++, entry.total += elapsed, entry.buckets[i]++;
+            elapsed < entry.min && (entry.min = elapsed), elapsed > entry.max && (entry.max = elapsed);
+        };
+        stats.cache = (name, hit) => {
+            const entry = caches[name] || (caches[name] = { hits: 0, misses: 0 });
+            hit ? entry.hits++ : entry.misses++;
+            return hit;
+        };
+        stats.resident = () => ({ cisTables: cisTables.bytes(), iterations: iterate.bytes(), plans: codelets.bytes(), batches: batches.bytes(), spectra: convolution.bytes(), polar: profiles.bytes(), wasm: simd.bytesResident() });
+        stats.snapshot = () => ({ since, timestamp: timestamp(), backend: backend.name(), wisdom: wisdom.entries(), actions, caches, resident: stats.resident(), bounds: stats.bounds });
+        stats.reset = () => (actions = {}, caches = {}, since = timestamp());
+    })(stats || (stats = {}));
     let cisTables;
     (function (cisTables) {
         const { PI, abs, sin, cos, sqrt, max } = Math;
@@ -40,7 +68,9 @@ var FFT;
         }
         cisTables.CISTable = CISTable;
         const tables = new Map();
-        cisTables.get = (size) => (!tables.has(size) && tables.set(size, new CISTable(size)), tables.get(size));
+        cisTables.get = (size) => (!stats.cache('cisTables', tables.has(size)) && tables.set(size, new CISTable(size)), tables.get(size));
+        cisTables.bytes = () => { let bytes = 0; for (const table of tables.values())
+            bytes += table.byteLength; return bytes; };
     })(cisTables || (cisTables = {}));
     cisTables = Object.assign(cisTables.get, cisTables);
     const compare = (a, b, keys) => (typeof a === typeof b && (!a || keys.every((key) => a[key] === b[key])));
@@ -61,7 +91,7 @@ var FFT;
         function generate(size = 0, start = 0, offset = 0, step = 1) {
             let iterations;
             if (!start && !offset && step === 1) {
-                if (iterators.has(size))
+                if (stats.cache('iterations', iterators.has(size)))
                     return iterators.get(size);
                 const started = now();
                 generator(size, start, offset, step, iterations = []).next();
@@ -75,6 +105,8 @@ var FFT;
             return iterations;
         }
         iterate_1.generate = generate;
+        iterate_1.bytes = () => { let bytes = 0; for (const iterations of iterators.values())
+            bytes += iterations.length * 3 * 8; return bytes; };
         function iterate({ start = 0, offset = 0, size = 0, step = 1, remaining = true, completed = 0 }, callback) {
             const iterations = (!start && !offset && step === 1 && iterators.get(size)) || generate(size);
             let i;
@@ -88,6 +120,278 @@ var FFT;
         iterate_1.iterate = iterate;
     })(iterate || (iterate = {}));
     iterate = Object.assign(iterate.iterate, iterate);
+    let codelets;
+    (function (codelets) {
+        // Larger bodies outgrow what the optimising compiler will take on and end up slower than the loop.
+        codelets.maxSize = 32;
+        const snap = (value) => abs(value) < 1e-12 ? 0 : abs(abs(value) - 1) < 1e-12 ? Math.sign(value) : value;
+        // Emits a straight-line radix-2 DIT transform of `size` points read at `offset + m * stride`, with the
+        // twiddles folded into constants and multiplications by 0, ±1 and ±i dropped.
+        codelets.source = (size, sign, integer, fromReal) => {
+            const lines = [], read = (index) => integer ? `$in[${index}]` : `($in[${index}] || 0)`;
+            let temporaries = 0;
+            const value = (expression) => /^(0|-?[a-z]\d+)$/.test(expression) ? expression : (lines.push(`const t${temporaries} = ${expression};`), `t${temporaries++}`);
+            const neg = (a) => a === '0' ? '0' : a[0] === '-' ? a.slice(1) : `-${a}`;
+            const plus = (a, b) => a === '0' ? b : b === '0' ? a : b[0] === '-' ? `${a} - ${b.slice(1)}` : `${a} + ${b}`;
+            const minus = (a, b) => plus(a, neg(b));
+            const times = (a, k) => a === '0' || k === 0 ? '0' : k === 1 ? a : k === -1 ? neg(a) : k < 0 ? neg(times(a, -k)) : `${a} * ${k}`;
+            const transform = (indices) => {
+                if (indices.length === 1) {
+                    const [m] = indices, index = m ? `offset + ${m} * stride` : 'offset';
+                    return [fromReal ? [value(read(index)), '0'] : [value(read(`(${index}) * 2`)), value(read(`(${index}) * 2 + 1`))]];
+                }
+                const half = indices.length / 2;
+                const even = transform(indices.filter((m, i) => !(i & 1))), odd = transform(indices.filter((m, i) => i & 1));
+                const outputs = [];
+                for (let k = 0; k < half; k++) {
+                    const [r1, i1] = even[k], [r2, i2] = odd[k], angle = PI2 * k / indices.length;
+                    const rt = snap(cos(angle)), it = snap(sign * sin(angle));
+                    const rk = value(plus(times(r2, rt), times(i2, it))), ik = value(minus(times(i2, rt), times(r2, it)));
+                    outputs[k] = [value(plus(r1, rk)), value(plus(i1, ik))];
+                    outputs[k + half] = [value(minus(r1, rk)), value(minus(i1, ik))];
+                }
+                return outputs;
+            };
+            const outputs = transform(Array.from(Array(size).keys()));
+            outputs.forEach(([real, imag], k) => lines.push(`$out[o + ${k * 2}] = ${real}, $out[o + ${k * 2 + 1}] = ${imag};`));
+            return ['const o = start * 2;', ...lines].join('\n');
+        };
+        codelets.sizes = [8, 16, 32];
+        const plans = new Map();
+        // Splits the recursion into codelet leaves ([start, offset] pairs) and the remaining integrate passes.
+        codelets.plan = (size, leafSize = codelets.maxSize) => {
+            leafSize = Math.min(leafSize, size);
+            const key = `${size}:${leafSize}`;
+            if (stats.cache('plans', plans.has(key)))
+                return plans.get(key);
+            const iterations = iterate.generate(size), leaves = [], passes = [];
+            for (const iteration of iterations)
+                iteration[0] === leafSize ? leaves.push(iteration[1], iteration[2]) : iteration[0] > leafSize && passes.push(iteration);
+            const plan = { size, leafSize, stride: size / leafSize, leaves: Int32Array.from(leaves), passes, iterations };
+            return plans.set(key, plan), plan;
+        };
+        codelets.bytes = () => { let bytes = 0; for (const plan of plans.values())
+            bytes += plan.leaves.byteLength + plan.passes.length * 8; return bytes; };
+    })(codelets || (codelets = {}));
+    let kernels;
+    (function (kernels) {
+        const kernelsByKey = new Map();
+        const integerTypes = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array, Int32Array, Uint32Array];
+        const isInteger = (data) => integerTypes.some((type) => data instanceof type);
+        kernels.sizeClass = (size) => size <= 1 << 12 ? 'small' : size <= 1 << 18 ? 'medium' : 'large';
+        kernels.key = ($in, $out, fromReal, size, sign, leafSize) => `${$in.constructor.name} → ${$out.constructor.name} ${fromReal ? 'real' : 'complex'} ${sign > 0 ? 'forward' : 'inverse'} ${kernels.sizeClass(size)} ${leafSize}`;
+        kernels.source = (integer, fromReal, leafSize, sign) => `"use strict";
+return function kernel($in, $out, cis, sign, n, n4, plan, operation) {
+    const leaves = plan.leaves, passes = plan.passes, stride = plan.stride;
+    for (let j = 0, length = leaves.length; j < length; j += 2) {
+        if (!(j & 0x3ff) && operation.aborted) return false;
+        const start = leaves[j], offset = leaves[j + 1];
+        ${codelets.source(leafSize, sign, integer, fromReal).replace(/\n/g, '\n        ')}
+    }
+    for (let j = 0, length = passes.length; j < length; j++) {
+        if (operation.aborted) return false;
+        const iteration = passes[j], size = iteration[0], start = iteration[1];
+        for (let half = size / 2, end = start + half, d = n / size, k = start, h = 0; k < end; k++, h += d) {
+            const k1 = k * 2, k2 = (k + half) * 2, r1 = $out[k1], i1 = $out[k1 + 1], r2 = $out[k2], i2 = $out[k2 + 1];
+            const rt = cis[h + n4], it = sign * cis[h], rk = (r2 || i2) && r2 * rt + i2 * it, ik = (r2 || i2) && -r2 * it + i2 * rt;
+            $out[k1] += rk, $out[k1 + 1] += ik, $out[k2] = r1 - rk, $out[k2 + 1] = i1 - ik;
+        }
+    }
+    return true;
+};`;
+        const generic = (fromReal) => ($in, $out, cis, sign, n, n4, { iterations }, operation) => {
+            for (let j = 0, length = iterations.length; j < length; j++) {
+                if (operation.aborted)
+                    return false;
+                const [size, start, offset] = iterations[j];
+                if (size === 1) {
+                    $out[start * 2] = (fromReal ? $in[offset] : $in[offset * 2]) || 0, $out[start * 2 + 1] = fromReal ? 0 : $in[offset * 2 + 1] || 0;
+                    continue;
+                }
+                for (let half = size / 2, end = start + half, d = n / size, k = start, h = 0; k < end; k++, h += d) {
+                    const k1 = k * 2, k2 = (k + half) * 2, r1 = $out[k1], i1 = $out[k1 + 1], r2 = $out[k2], i2 = $out[k2 + 1];
+                    const rt = cis[h + n4], it = sign * cis[h], rk = (r2 || i2) && r2 * rt + i2 * it, ik = (r2 || i2) && -r2 * it + i2 * rt;
+                    $out[k1] += rk, $out[k1 + 1] += ik, $out[k2] = r1 - rk, $out[k2 + 1] = i1 - ik;
+                }
+            }
+            return true;
+        };
+        kernels.create = ($in, $out, fromReal, leafSize, sign) => {
+            try {
+                return new Function(kernels.source(isInteger($in), fromReal, leafSize, sign))();
+            }
+            catch (exception) {
+                return generic(fromReal);
+            }
+        };
+        kernels.get = ($in, $out, fromReal, size, sign, leafSize = Math.min(codelets.maxSize, size)) => {
+            const key = kernels.key($in, $out, fromReal, size, sign, leafSize);
+            stats.cache('kernels', kernelsByKey.has(key)) || kernelsByKey.set(key, kernels.create($in, $out, fromReal, leafSize, sign));
+            return kernelsByKey.get(key);
+        };
+        kernels.keys = () => [...kernelsByKey.keys()];
+    })(kernels || (kernels = {}));
+    let simd;
+    (function (simd) {
+        const uleb = (value, bytes = []) => { do {
+            const byte = value & 0x7f;
+            value >>>= 7, bytes.push(value ? byte | 0x80 : byte);
+        } while (value); return bytes; };
+        const sleb = (value, bytes = []) => { for (;;) {
+            const byte = value & 0x7f;
+            value >>= 7;
+            if ((value === 0 && !(byte & 0x40)) || (value === -1 && byte & 0x40))
+                return bytes.push(byte), bytes;
+            bytes.push(byte | 0x80);
+        } };
+        const vector = (items) => [...uleb(items.length), ...[].concat(...items)];
+        const string = (text) => vector([...text].map((character) => [character.charCodeAt(0)]));
+        const section = (id, bytes) => [id, ...uleb(bytes.length), ...bytes];
+        const code = (...parts) => [].concat(...parts);
+        const [i32, f32, v128] = [0x7f, 0x7d, 0x7b];
+        const block = [0x02, 0x40], loop = [0x03, 0x40], when = [0x04, 0x40], otherwise = [0x05], end = [0x0b];
+        const br = (depth) => [0x0c, ...uleb(depth)], br_if = (depth) => [0x0d, ...uleb(depth)];
+        const get = (index) => [0x20, ...uleb(index)], set = (index) => [0x21, ...uleb(index)], tee = (index) => [0x22, ...uleb(index)];
+        const constant = (value) => [0x41, ...sleb(value)];
+        const add = [0x6a], shl = [0x74], shr_u = [0x76], div_u = [0x6e], ge_u = [0x4f];
+        const f32_load = (offset = 0) => [0x2a, 2, ...uleb(offset)], f32_store = (offset = 0) => [0x38, 2, ...uleb(offset)];
+        const f32_add = [0x92], f32_sub = [0x93], f32_mul = [0x94], f32_neg = [0x8c];
+        const vector_op = (opcode, ...immediates) => [0xfd, ...uleb(opcode), ...immediates];
+        const v128_load = (offset = 0) => vector_op(0x00, 4, ...uleb(offset)), v128_store = (offset = 0) => vector_op(0x0b, 4, ...uleb(offset));
+        const v128_load64_splat = (offset = 0) => vector_op(0x0a, 3, ...uleb(offset));
+        const shuffle = (...lanes) => vector_op(0x0d, ...[].concat(...lanes.map((lane) => [lane * 4, lane * 4 + 1, lane * 4 + 2, lane * 4 + 3])));
+        const splat = vector_op(0x13), replace_lane = (lane) => vector_op(0x20, lane);
+        const f32x4_sqrt = vector_op(0xe3), f32x4_add = vector_op(0xe4), f32x4_sub = vector_op(0xe5), f32x4_mul = vector_op(0xe6);
+        const body = (locals, ...parts) => {
+            const bytes = [...vector(locals.map(([count, type]) => [...uleb(count), type])), ...code(...parts), ...end];
+            return [...uleb(bytes.length), ...bytes];
+        };
+        // stage(out, cis, n, n4, size, sign): one radix-2 pass over every block of `size`, two butterflies per f32x4
+        const stage = (() => {
+            const [out, cis, n, n4, size, sign, half, d, start, k, h, p1, p2, rt, it, r1, i1, r2, i2, rk, ik, a, b, c, T, S] = Array.from(Array(26).keys());
+            const pointers = code(get(out), get(start), get(k), add, constant(3), shl, add, tee(p1), get(half), constant(3), shl, add, set(p2));
+            const cisAt = (...index) => code(get(cis), ...index, constant(2), shl, add, f32_load());
+            return body([[7, i32], [8, f32], [5, v128]], get(size), constant(1), shr_u, set(half), get(n), get(size), div_u, set(d), constant(0), set(start), block, loop, get(start), get(n), ge_u, br_if(1), constant(0), set(k), constant(0), set(h), get(half), constant(2), ge_u, when, block, loop, get(k), get(half), ge_u, br_if(1), pointers, cisAt(get(h), get(n4), add), splat, set(T), cisAt(get(h), get(d), add, get(n4), add), set(rt), get(T), get(rt), replace_lane(2), get(rt), replace_lane(3), set(T), get(sign), cisAt(get(h)), f32_mul, set(it), get(it), splat, get(it), f32_neg, replace_lane(1), set(S), get(sign), cisAt(get(h), get(d), add), f32_mul, set(it), get(S), get(it), replace_lane(2), get(it), f32_neg, replace_lane(3), set(S), get(p1), v128_load(), set(a), get(p2), v128_load(), set(b), get(b), get(T), f32x4_mul, get(b), get(b), shuffle(1, 0, 3, 2), get(S), f32x4_mul, f32x4_add, set(c), get(p1), get(a), get(c), f32x4_add, v128_store(), get(p2), get(a), get(c), f32x4_sub, v128_store(), get(k), constant(2), add, set(k), get(h), get(d), constant(1), shl, add, set(h), br(0), end, end, otherwise, block, loop, get(k), get(half), ge_u, br_if(1), pointers, cisAt(get(h), get(n4), add), set(rt), get(sign), cisAt(get(h)), f32_mul, set(it), get(p1), f32_load(0), set(r1), get(p1), f32_load(4), set(i1), get(p2), f32_load(0), set(r2), get(p2), f32_load(4), set(i2), get(r2), get(rt), f32_mul, get(i2), get(it), f32_mul, f32_add, set(rk), get(i2), get(rt), f32_mul, get(r2), get(it), f32_mul, f32_sub, set(ik), get(p1), get(r1), get(rk), f32_add, f32_store(0), get(p1), get(i1), get(ik), f32_add, f32_store(4), get(p2), get(r1), get(rk), f32_sub, f32_store(0), get(p2), get(i1), get(ik), f32_sub, f32_store(4), get(k), constant(1), add, set(k), get(h), get(d), add, set(h), br(0), end, end, end, get(start), get(size), add, set(start), br(0), end, end);
+        })();
+        // magnitude(in, out, count): |z| for four complex values per iteration
+        const magnitude = (() => {
+            const [input, output, count, i, p, a, b] = Array.from(Array(7).keys());
+            return body([[2, i32], [2, v128]], block, loop, get(i), get(count), ge_u, br_if(1), get(input), get(i), constant(3), shl, add, set(p), get(p), v128_load(0), tee(a), get(a), f32x4_mul, set(a), get(p), v128_load(16), tee(b), get(b), f32x4_mul, set(b), get(output), get(i), constant(2), shl, add, get(a), get(b), shuffle(0, 2, 4, 6), get(a), get(b), shuffle(1, 3, 5, 7), f32x4_add, f32x4_sqrt, v128_store(), get(i), constant(4), add, set(i), br(0), end, end);
+        })();
+        // filter(in, mask, out, count): complex × real mask for two complex values per iteration
+        const filter = (() => {
+            const [input, mask, output, count, i, m] = Array.from(Array(6).keys());
+            return body([[1, i32], [1, v128]], block, loop, get(i), get(count), ge_u, br_if(1), get(output), get(i), constant(3), shl, add, get(input), get(i), constant(3), shl, add, v128_load(), get(mask), get(i), constant(2), shl, add, v128_load64_splat(), tee(m), get(m), shuffle(0, 0, 1, 1), f32x4_mul, v128_store(), get(i), constant(2), add, set(i), br(0), end, end);
+        })();
+        simd.bytes = new Uint8Array([0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+            ...section(1, vector([[0x60, ...vector([[i32], [i32], [i32], [i32], [i32], [f32]]), 0x00], [0x60, ...vector([[i32], [i32], [i32]]), 0x00], [0x60, ...vector([[i32], [i32], [i32], [i32]]), 0x00]])),
+            ...section(2, vector([[...string('env'), ...string('memory'), 0x02, 0x00, 0x01]])),
+            ...section(3, vector([[0], [1], [2]])),
+            ...section(7, vector([[...string('stage'), 0x00, 0], [...string('magnitude'), 0x00, 1], [...string('filter'), 0x00, 2]])),
+            ...section(10, vector([stage, magnitude, filter])),
+        ]);
+        let supported, instance, memory, heap, cisSize = 0;
+        const leavesBySize = new Map();
+        simd.supported = () => supported !== undefined ? supported
+            : (supported = typeof WebAssembly === 'object' && (() => { try {
+                return WebAssembly.validate(simd.bytes);
+            }
+            catch (exception) {
+                return false;
+            } })());
+        simd.load = () => instance || (memory = new WebAssembly.Memory({ initial: 1 }),
+            instance = new WebAssembly.Instance(new WebAssembly.Module(simd.bytes), { env: { memory } }), heap = new Float32Array(memory.buffer), instance);
+        // Layout in floats for n complex values: [0, 2n) transform, [2n, 3.25n) cis table, [4n, 6n) spectrum, [6n, 7n) mask, [7n, 8n) magnitudes
+        simd.reserve = (n) => {
+            simd.load();
+            const needed = n * 8 * 4 - memory.buffer.byteLength;
+            needed > 0 && memory.grow(Math.ceil(needed / 65536));
+            heap.buffer !== memory.buffer && (heap = new Float32Array(memory.buffer), cisSize = 0);
+            return heap;
+        };
+        simd.bytesResident = () => memory ? memory.buffer.byteLength : 0;
+        const leaves = (size, iterations) => {
+            if (leavesBySize.has(size))
+                return leavesBySize.get(size);
+            const offsets = new Int32Array(size);
+            for (const [length, start, offset] of iterations)
+                length === 1 && (offsets[start] = offset);
+            return leavesBySize.set(size, offsets), offsets;
+        };
+        // Bit-reverses `source` (real or interleaved complex, starting at float `base`) into [0, 2n) and runs every pass
+        simd.fft = (source, base, fromReal, size, cis, sign, iterations, operation) => {
+            const n = size, offsets = leaves(size, iterations);
+            if (cisSize !== n)
+                heap.set(cis, 2 * n), cisSize = n;
+            if (fromReal)
+                for (let start = 0; start < n; start++)
+                    heap[start * 2] = source[base + offsets[start]] || 0, heap[start * 2 + 1] = 0;
+            else
+                for (let start = 0, offset; start < n; start++)
+                    offset = base + offsets[start] * 2, heap[start * 2] = source[offset] || 0, heap[start * 2 + 1] = source[offset + 1] || 0;
+            for (let span = 2; span <= n; span <<= 1) {
+                if (operation.aborted)
+                    return false;
+                instance.exports.stage(0, 2 * n * 4, n, n >> 2, span, sign);
+            }
+            return true;
+        };
+        simd.transform = ($in, $out, fromReal, size, cis, sign, iterations, operation) => {
+            simd.reserve(size);
+            const done = simd.fft($in, 0, fromReal, size, cis, sign, iterations, operation);
+            return done && $out.set(heap.subarray(0, size * 2)), done;
+        };
+        simd.filter = (spectrum, size) => (heap.set(spectrum, 4 * size), instance.exports.filter(4 * size * 4, 6 * size * 4, 4 * size * 4, size), heap.subarray(4 * size, 6 * size));
+        simd.magnitude = (size) => (instance.exports.magnitude(4 * size * 4, 7 * size * 4, size), heap.subarray(7 * size, 8 * size));
+        simd.mask = (size) => heap.subarray(6 * size, 7 * size);
+    })(simd || (simd = {}));
+    let wisdom;
+    (function (wisdom) {
+        // Winning { backend, codelet } per transform size, tuned here or handed down from the page's store.
+        const entries = new Map();
+        wisdom.get = (size) => entries.get(size) || entries.get(2 ** (2 * Math.ceil(Math.log2(size) / 2)));
+        wisdom.set = (sizes = {}) => { for (const size in sizes)
+            sizes[size] ? entries.set(+size, sizes[size]) : entries.delete(+size); return wisdom.entries(); };
+        wisdom.entries = () => { const sizes = {}; for (const [size, entry] of entries)
+            sizes[size] = entry; return sizes; };
+        wisdom.codelet = (size) => (wisdom.get(size) || {}).codelet || codelets.maxSize;
+        wisdom.candidates = (size) => [
+            ...codelets.sizes.filter((codelet, i) => codelet <= size || !i).map((codelet) => ({ backend: 'js', codelet })),
+            ...simd.supported() ? [{ backend: 'wasm' }] : [],
+        ];
+        // Times every candidate strategy on a synthetic image of `width`² and keeps the fastest one.
+        wisdom.tune = ({ width, repeat = 5 } = {}) => {
+            const size = width * width, input = new Float32Array(size).map((v, i) => (i * 7919 % 256));
+            const output = new Float32Array(size * 2), { preferred } = backend, previous = entries.get(size), candidates = [];
+            backend.preferred = 'auto';
+            for (const candidate of wisdom.candidates(size)) {
+                // Warm up until the generated kernel has been optimised, so compile time doesn't decide the winner.
+                entries.set(size, candidate);
+                for (let i = 0, started = now(); i < repeat || (i < 50 && now() - started < 50); i++)
+                    transform(input, output, 'forward');
+                let time = Infinity;
+                for (let i = 0, started; i < repeat; i++)
+                    started = now(), transform(input, output, 'forward'), time = Math.min(time, now() - started);
+                candidates.push(Object.assign({ time }, candidate));
+            }
+            backend.preferred = preferred;
+            const best = candidates.reduce((best, candidate) => candidate.time < best.time ? candidate : best, candidates[0]);
+            best ? entries.set(size, { backend: best.backend, codelet: best.codelet }) : previous ? entries.set(size, previous) : entries.delete(size);
+            return { width, candidates, best };
+        };
+    })(wisdom || (wisdom = {}));
+    let backend;
+    (function (backend) {
+        backend.preferred = 'auto';
+        backend.set = (name = 'auto') => (backend.preferred = /^(js|wasm|auto)$/.test(name) ? name : 'auto', backend.name());
+        backend.name = (size) => backend.preferred !== 'js' && simd.supported() && (backend.preferred === 'wasm' || (wisdom.get(size) || {}).backend !== 'js') ? 'wasm' : 'js';
+        backend.wasm = (size) => size >= 4 && backend.name(size) === 'wasm' && (() => { try {
+            return !!simd.load();
+        }
+        catch (exception) {
+            return console.warn(exception), backend.preferred = 'js', false;
+        } })();
+    })(backend || (backend = {}));
     const operations = {};
     function transform($in, $out, direction, operation = { aborted: false }) {
         const forward = direction === 'forward', sign = forward ? 1 : -1, PIt = PI2;
@@ -97,28 +401,409 @@ var FFT;
         const cis = cisTables(size), [n, n2, n4, n8] = cis.n;
         if (!size || !(validData && (fromReal || fromComplex)))
             return false;
-        const integrate = (size, start, offset) => {
-            const length = size / 2, end = start + length, d = n / size;
-            for (let k = start, h = 0, k1, k2, r1, i1, r2, i2, rt, it, rk, ik; (k1 = imul(k, 2), k2 = imul(k + length, 2),
-                r1 = $out[k1], i1 = $out[k1 + 1],
-                r2 = $out[k2], i2 = $out[k2 + 1],
-                rt = cis[h + n4], it = sign * cis[h],
-                rk = (r2 || i2) && r2 * rt + i2 * it, ik = (r2 || i2) && -r2 * it + i2 * rt), k < end; k++ , h += d)
-                $out[k1] += rk, $out[k1 + 1] += ik, $out[k2] = r1 - rk, $out[k2 + 1] = i1 - ik;
-            return true;
-        };
-        const translate = fromReal ? (start, offset) => ($out[start * 2] = $in[offset] || 0, $out[start * 2 + 1] = 0, true)
-            : fromComplex ? (start, offset) => ($out[start * 2] = $in[offset * 2] || 0, $out[start * 2 + 1] = $in[offset * 2 + 1] || 0, true)
-                : (start, offset) => false;
-        const aggregate = (size, start, offset) => !operation.aborted && (size === 1 ? translate(start, offset) : size > 1 ? integrate(size, start, offset) : false);
-        return iterate({ size }, aggregate), true;
+        if (backend.wasm(size))
+            return simd.transform($in, $out, fromReal, size, cis, sign, iterate.generate(size), operation);
+        const leafSize = Math.min(wisdom.codelet(size), size), kernel = kernels.get($in, $out, fromReal, size, sign, leafSize);
+        return kernel($in, $out, cis, sign, n, n4, codelets.plan(size, leafSize), operation);
     }
     FFT.transform = transform;
+    let batches;
+    (function (batches_1) {
+        const spectraByKey = new Map();
+        batches_1.limit = 2;
+        batches_1.forward = (key, inputs = []) => {
+            const spectra = Object.assign(inputs.map((input) => {
+                const spectrum = new Float32Array(new SharedArrayBuffer(input.length * 4 * 2));
+                return transform(input, spectrum, 'forward'), spectrum;
+            }), { inputs });
+            spectraByKey.delete(key), spectraByKey.set(key, spectra);
+            for (const key of spectraByKey.keys())
+                if (spectraByKey.size > batches_1.limit)
+                    spectraByKey.delete(key);
+            return spectra;
+        };
+        batches_1.mask = (filter, width, length, { stop = false, weights, mask = new Float32Array(length) } = {}) => {
+            const dx = floor(width / 2), dl = floor(length / 2), sensitivity = weights && weights.length === length ? new Float32Array(length) : undefined;
+            for (let i = 0, x, j, h; i < length; i++)
+                x = i % width, j = (i - x - ((dx - x) % width) + dl) % length, h = filter[j] || 0, mask[i] = stop ? 1 - h : h,
+                    sensitivity && (sensitivity[i] = weights[j] ** 2);
+            return { mask, sensitivity };
+        };
+        batches_1.measure = (spectrum, mask, sensitivity, filtered) => {
+            let energy = 0, weighted = 0, total = 0;
+            for (let i = 1, length = mask.length, h, a, b, re, im, e; i < length; i++)
+                a = spectrum[i * 2], b = spectrum[i * 2 + 1], h = mask[i], re = a * h, im = b * h, e = re * re + im * im,
+                    total += a * a + b * b, energy += e, sensitivity && (weighted += e * sensitivity[i]), filtered && (filtered[i * 2] = re, filtered[i * 2 + 1] = im);
+            filtered && (filtered[0] = spectrum[0] * mask[0], filtered[1] = spectrum[1] * mask[0]);
+            return { energy, weighted, total, dc: hypot(spectrum[0], spectrum[1]) || 1 };
+        };
+        batches_1.filterInverse = (key, filter, width, { stop = false, spectra: withSpectra = false, weights, scorers: names, tiles = 0 } = {}) => {
+            const spectra = spectraByKey.get(key);
+            if (!spectra || !spectra.length || !filter)
+                return;
+            const length = spectra[0].length / 2, dx = floor(width / 2), dl = floor(length / 2);
+            const heap = backend.wasm(length) && simd.reserve(length), idle = { aborted: false };
+            const { mask, sensitivity } = batches_1.mask(filter, width, length, { stop, weights, mask: heap ? simd.mask(length) : undefined });
+            const filtered = heap ? undefined : new Float32Array(length * 2), intrim = heap || new Float32Array(length * 2);
+            const outputs = [], ranges = [], magnitudes = withSpectra ? [] : undefined, maxima = withSpectra ? [] : undefined;
+            const contrast = [], visibility = sensitivity ? [] : undefined, scores = names && scorers.scores(names);
+            const height = length / width, energies = tiles > 0 ? [] : undefined, means = energies && [];
+            for (const [index, spectrum] of spectra.entries()) {
+                const band = batches_1.measure(spectrum, mask, sensitivity, filtered);
+                contrast.push(band.energy ** 0.5 / band.dc), visibility && visibility.push(band.weighted ** 0.5 / band.dc), means && means.push(band.dc / length);
+                scores && scorers.score(scores, scorers.artefacts({ input: spectra.inputs[index], spectrum, width, mask, sensitivity, band }));
+                if (heap)
+                    simd.filter(spectrum, length);
+                if (withSpectra) {
+                    const magnitude = new Float32Array(length), contiguous = heap && simd.magnitude(length);
+                    let max = 0;
+                    for (let i = 0, x, j, m; i < length; i++)
+                        x = i % width, j = (i - x + ((dx - x) % width) + dl) % length,
+                            m = magnitude[i] = contiguous ? contiguous[j] : hypot(filtered[j * 2], filtered[j * 2 + 1]), m > max && (max = m);
+                    magnitudes.push(magnitude), maxima.push(max);
+                }
+                if (heap)
+                    simd.fft(heap, 4 * length, false, length, cisTables(length), -1, iterate.generate(length), idle);
+                else
+                    transform(filtered, intrim, 'inverse');
+                const output = new Float32Array(length);
+                let min = Infinity, max = -Infinity;
+                for (let k = 0, v; k < length; k++)
+                    v = output[k] = intrim[k * 2] / length, v > max && (max = v), v < min && (min = v);
+                outputs.push(output), ranges.push([min, max]);
+                if (energies) {
+                    const count = tiles * tiles, sums = new Float64Array(count), squares = new Float64Array(count), pixels = new Float64Array(count), energy = new Float32Array(count);
+                    let mean = 0;
+                    for (let y = 0, k = 0; y < height; y++)
+                        for (let x = 0, row = floor(y * tiles / height) * tiles, t, v; x < width; x++, k++)
+                            t = row + floor(x * tiles / width), v = output[k], sums[t] += v, squares[t] += v * v, pixels[t]++, mean += v;
+                    mean /= length;
+                    for (let t = 0; t < count; t++)
+                        energy[t] = pixels[t] ? (squares[t] - 2 * mean * sums[t]) / pixels[t] + mean * mean : 0;
+                    energies.push(energy);
+                }
+            }
+            return { outputs, ranges, magnitudes, maxima, contrast, visibility, energies, means, scores, labels: scores && scorers.labels() };
+        };
+        batches_1.get = (key) => spectraByKey.get(key);
+        batches_1.release = (key) => spectraByKey.delete(key);
+        batches_1.bytes = () => { let bytes = 0; for (const spectra of spectraByKey.values())
+            for (const array of [...spectra, ...spectra.inputs])
+                bytes += array.byteLength; return bytes; };
+    })(batches || (batches = {}));
+    FFT.batches = batches;
+    let profiles;
+    (function (profiles) {
+        const maps = new Map();
+        profiles.limit = 32;
+        profiles.quantum = 4;
+        profiles.map = (width, height, x, y) => {
+            const q = profiles.quantum, cx = Math.round(x * q) / q, cy = Math.round(y * q) / q, key = `${width}×${height}@${cx},${cy}`;
+            let map = maps.get(key);
+            if (stats.cache('polar', !!map))
+                return maps.delete(key), maps.set(key, map), map;
+            const rings = Math.max(1, Math.floor(Math.min(cx, cy, width - 1 - cx, height - 1 - cy)) + 1);
+            const index = new Uint16Array(width * height).fill(rings), counts = new Float32Array(rings);
+            for (let y = 0, i = 0; y < height; y++)
+                for (let x = 0, r; x < width; x++, i++)
+                    r = Math.round(hypot(x - cx, y - cy)), r < rings && (index[i] = r, counts[r]++);
+            maps.set(key, map = { width, height, centre: [cx, cy], rings, index, counts });
+            for (const key of maps.keys())
+                if (maps.size > profiles.limit)
+                    maps.delete(key);
+            return map;
+        };
+        const vertex = (l, c, r, d = l - 2 * c + r) => d < 0 ? Math.max(-0.5, Math.min(0.5, (l - r) / (2 * d))) : 0;
+        profiles.centroid = (input, width) => {
+            const length = input.length, height = length / width;
+            let mean = 0, total = 0, sx = 0, sy = 0;
+            for (let i = 0; i < length; i++)
+                mean += input[i];
+            mean /= length;
+            for (let y = 0, i = 0; y < height; y++)
+                for (let x = 0, m; x < width; x++, i++)
+                    m = abs(input[i] - mean), total += m, sx += m * x, sy += m * y;
+            return total > 0 ? [sx / total, sy / total] : [(width - 1) / 2, (height - 1) / 2];
+        };
+        profiles.centre = (input, spectrum, width) => {
+            const length = input.length, height = length / width;
+            const product = new Float32Array(length * 2), intrim = new Float32Array(length * 2);
+            for (let i = 1, r, a, b; i < length; i++)
+                r = i * 2, a = spectrum[r], b = spectrum[r + 1], product[r] = a * a - b * b, product[r + 1] = 2 * a * b;
+            transform(product, intrim, 'inverse');
+            let peak = 0;
+            for (let k = 1; k < length; k++)
+                intrim[k * 2] > intrim[peak * 2] && (peak = k);
+            const at = (x, y) => intrim[(((y + height) % height) * width + (x + width) % width) * 2];
+            const px = peak % width, py = (peak - px) / width, c = at(px, py);
+            const x = px + vertex(at(px - 1, py), c, at(px + 1, py)), y = py + vertex(at(px, py - 1), c, at(px, py + 1));
+            const [ex, ey] = profiles.centroid(input, width);
+            let centre, distance = Infinity;
+            for (const [cx, cy] of [[x / 2, y / 2], [x / 2, (y + height) / 2], [(x + width) / 2, (y - 1) / 2], [(x + width) / 2, (y - 1 + height) / 2]])
+                hypot(cx - ex, cy - ey) < distance && (distance = hypot(cx - ex, cy - ey), centre = [cx, cy % height]);
+            return centre;
+        };
+        profiles.profile = (input, { rings, index, counts }) => {
+            const profile = new Float32Array(rings);
+            for (let i = 0, r, length = input.length; i < length; i++)
+                (r = index[i]) < rings && (profile[r] += input[i]);
+            for (let r = 0; r < rings; r++)
+                profile[r] = counts[r] ? profile[r] / counts[r] : r ? profile[r - 1] : 0;
+            return profile;
+        };
+        profiles.modulation = (profile) => {
+            const rings = [], last = profile.length - 1, troughs = [];
+            for (let r = 1; r < last; r++)
+                profile[r] < profile[r - 1] && profile[r] <= profile[r + 1] && troughs.push(r);
+            for (let r = 1, t = 0; r < last; r++) {
+                const peak = profile[r];
+                if (!(peak >= profile[r - 1] && peak > profile[r + 1]))
+                    continue;
+                while (t < troughs.length && troughs[t] < r)
+                    t++;
+                const inner = troughs[t - 1], outer = troughs[t], trough = Math.min(inner >= 0 ? profile[inner] : peak, outer >= 0 ? profile[outer] : peak);
+                rings.push({ radius: r + vertex(profile[r - 1], peak, profile[r + 1]), peak, trough, depth: peak + trough > 0 ? (peak - trough) / (peak + trough) : 0 });
+            }
+            return rings;
+        };
+        profiles.analyse = (key, width) => {
+            const spectra = batches.get(key);
+            if (!spectra || !spectra.length)
+                return;
+            return spectra.map((spectrum, i) => {
+                const input = spectra.inputs[i], height = input.length / width, centre = profiles.centre(input, spectrum, width);
+                const profile = profiles.profile(input, profiles.map(width, height, ...centre));
+                return { centre, profile, rings: profiles.modulation(profile) };
+            });
+        };
+        profiles.bytes = () => { let bytes = 0; for (const { index, counts } of maps.values())
+            bytes += index.byteLength + counts.byteLength; return bytes; };
+    })(profiles || (profiles = {}));
+    FFT.profiles = profiles;
+    let calibration;
+    (function (calibration) {
+        calibration.minimum = 2;
+        const peak = (power, from, to) => {
+            let k = from;
+            for (let i = from; i < to; i++)
+                power[i] > power[k] && (k = i);
+            const l = power[k - 1], c = power[k], n = k + 1 < to ? power[k + 1] : l, d = l - 2 * c + n;
+            return [k + (d < 0 ? Math.max(-0.5, Math.min(0.5, (l - n) / (2 * d))) : 0), c];
+        };
+        calibration.radius = (spectrum, width) => {
+            const length = spectrum.length / 2, height = length / width, dx = floor(width / 2), dl = floor(length / 2), M2 = width / 2, N2 = height / 2;
+            const limit = Math.floor(Math.min(M2, N2)), power = new Float64Array(limit + 1), counts = new Float64Array(limit + 1);
+            for (let i = 1, x, j, u, r; i < length; i++)
+                x = i % width, j = (i - x - ((dx - x) % width) + dl) % length, u = j % width,
+                    r = Math.round(hypot(u - M2, (j - u) / width - N2)), r <= limit && (power[r] += spectrum[i * 2] ** 2 + spectrum[i * 2 + 1] ** 2, counts[r]++);
+            let mean = 0;
+            for (let r = calibration.minimum; r <= limit; r++)
+                power[r] /= counts[r] || 1, mean += power[r];
+            const [radius, c] = peak(power, calibration.minimum, limit + 1);
+            return { radius, prominence: mean ? c * (limit - calibration.minimum + 1) / mean : 0 };
+        };
+        calibration.line = (input, width, [cx, cy], horizontal) => {
+            const height = input.length / width, n = horizontal ? width : height, centre = Math.round(horizontal ? cy : cx), span = horizontal ? height : width;
+            const line = new Float32Array(n), spectrum = new Float32Array(n * 2), power = new Float64Array(n / 2);
+            let mean = 0;
+            for (let k = 0; k < n; k++) {
+                for (let o = -1; o <= 1; o++) {
+                    const m = Math.max(0, Math.min(span - 1, centre + o));
+                    line[k] += input[horizontal ? m * width + k : k * width + m] / 3;
+                }
+                mean += line[k] / n;
+            }
+            for (let k = 0; k < n; k++)
+                line[k] = (line[k] - mean) * (0.5 - 0.5 * cos(PI2 * k / n));
+            transform(line, spectrum, 'forward');
+            for (let k = 0; k < n / 2; k++)
+                power[k] = spectrum[k * 2] ** 2 + spectrum[k * 2 + 1] ** 2;
+            return peak(power, calibration.minimum, n / 2)[0];
+        };
+        calibration.measure = (input, spectrum, width) => {
+            const centre = profiles.centre(input, spectrum, width);
+            return Object.assign(calibration.radius(spectrum, width), { centre, x: calibration.line(input, width, centre, true), y: calibration.line(input, width, centre, false) });
+        };
+        calibration.run = (key, width) => {
+            const spectra = batches.get(key);
+            return spectra ? spectra.map((spectrum, i) => calibration.measure(spectra.inputs[i], spectrum, width)) : [];
+        };
+    })(calibration || (calibration = {}));
+    FFT.calibration = calibration;
+    let scorers;
+    (function (scorers) {
+        const registry = new Map();
+        scorers.threshold = 0.1;
+        scorers.register = (name, { label = name, score }) => (typeof score === 'function' && registry.set(name, { name, label, score }), registry.has(name));
+        scorers.define = ({ name, label, source }) => { try {
+            return scorers.register(name, { label, score: new Function('artefacts', `return (${source})(artefacts);`) });
+        }
+        catch (exception) {
+            return console.warn(exception), false;
+        } };
+        scorers.labels = () => { const labels = {}; for (const { name, label } of registry.values())
+            labels[name] = label; return labels; };
+        scorers.scores = (names = [...registry.keys()]) => { const scores = {}; for (const name of names)
+            registry.has(name) && (scores[name] = []); return scores; };
+        const lazy = (object, name, get) => Object.defineProperty(object, name, { configurable: true, enumerable: true, get: () => (Object.defineProperty(object, name, { value: get(), enumerable: true }), object[name]) });
+        scorers.artefacts = ({ input, spectrum, width, mask, sensitivity, band }) => {
+            const artefacts = { input, spectrum, width, height: input.length / width, mask, sensitivity };
+            band ? artefacts.band = band : lazy(artefacts, 'band', () => batches.measure(spectrum, mask, sensitivity));
+            lazy(artefacts, 'centre', () => profiles.centre(input, spectrum, width));
+            lazy(artefacts, 'polar', () => profiles.map(width, artefacts.height, ...artefacts.centre));
+            lazy(artefacts, 'profile', () => profiles.profile(input, artefacts.polar));
+            lazy(artefacts, 'rings', () => profiles.modulation(artefacts.profile));
+            return artefacts;
+        };
+        scorers.score = (scores, artefacts) => {
+            for (const name in scores) {
+                let score = NaN;
+                try {
+                    score = +registry.get(name).score(artefacts);
+                }
+                catch (exception) {
+                    console.warn(exception);
+                }
+                scores[name].push(score);
+            }
+            return scores;
+        };
+        scorers.run = (key, { width, filter, weights, stop = false, scorers: names } = {}) => {
+            const spectra = batches.get(key);
+            if (!spectra || !spectra.length || !filter)
+                return;
+            const length = spectra[0].length / 2, { mask, sensitivity } = batches.mask(filter, width, length, { stop, weights }), scores = scorers.scores(names);
+            for (const [index, spectrum] of spectra.entries())
+                scorers.score(scores, scorers.artefacts({ input: spectra.inputs[index], spectrum, width, mask, sensitivity }));
+            return { scores, labels: scorers.labels() };
+        };
+        scorers.register('contrast', { label: 'Band contrast', score: ({ band: { energy, dc } }) => energy ** 0.5 / dc });
+        scorers.register('energy', { label: 'Band energy', score: ({ band: { energy, total } }) => total > 0 ? energy / total : 0 });
+        scorers.register('visibility', { label: 'Visibility', score: ({ band: { weighted, dc }, sensitivity }) => sensitivity ? weighted ** 0.5 / dc : NaN });
+        scorers.register('modulation', { label: 'Ring modulation', score: ({ rings }) => rings.length ? rings.reduce((sum, { depth }) => sum + depth, 0) / rings.length : 0 });
+        scorers.register('resolved', { label: 'Resolved rings', score: ({ rings }) => rings.filter(({ depth }) => depth >= scorers.threshold).length });
+    })(scorers || (scorers = {}));
+    FFT.scorers = scorers;
+    let bootstrap;
+    (function (bootstrap) {
+        /**
+         * Resamples the per-tile band energies of a bootstrap design (see app/modules/uncertainty.js) and returns the
+         * row thresholds and CR index of every iteration; seed 0 keeps the tiles in order and yields the point estimate.
+         */
+        bootstrap.resample = ({ energies, tiles, factors, rows, contrasts, resolutions, criterion }, iterations, seed = 0) => {
+            const patches = factors.length, metrics = new Float64Array(patches), thresholds = new Float32Array(iterations * rows.length), indices = new Float32Array(iterations);
+            let state = seed >>> 0;
+            const next = () => (state ^= state << 13, state ^= state >>> 17, state ^= state << 5, (state >>> 0) / 4294967296);
+            for (let b = 0; b < iterations; b++) {
+                for (let p = 0; p < patches; p++) {
+                    let sum = 0;
+                    for (let t = 0, base = p * tiles; t < tiles; t++)
+                        sum += energies[base + (seed ? next() * tiles | 0 : t)];
+                    metrics[p] = factors[p] * (sum / tiles) ** 0.5;
+                }
+                let index = 0, previous = NaN;
+                for (let r = 0; r < rows.length; r++) {
+                    const row = rows[r];
+                    let threshold = 100;
+                    for (let i = 0, m, c; i < row.length; i++)
+                        if (m = metrics[row[i]], c = contrasts[row[i]], m >= criterion) {
+                            const m0 = i ? metrics[row[i - 1]] : m, c0 = i ? contrasts[row[i - 1]] : c;
+                            threshold = i ? c0 * (c / c0) ** ((criterion - m0) / (m - m0 || 1)) : c;
+                            break;
+                        }
+                    const y = Math.log10(100 / threshold);
+                    index += r ? (resolutions[r] - resolutions[r - 1]) * (y + previous) / 2 : rows.length > 1 ? 0 : y, previous = y, thresholds[b * rows.length + r] = threshold;
+                }
+                indices[b] = index;
+            }
+            return { thresholds, indices };
+        };
+        bootstrap.run = ({ design, iterations, seed }) => {
+            try {
+                return bootstrap.resample(design, iterations, seed);
+            }
+            catch (exception) {
+                return console.warn(exception), undefined;
+            }
+        };
+    })(bootstrap || (bootstrap = {}));
+    FFT.bootstrap = bootstrap;
+    let convolution;
+    (function (convolution) {
+        const spectraByKey = new Map();
+        convolution.limit = 8;
+        convolution.spectrum = (key, kernel, kernelWidth, kernelHeight, tileWidth, tileHeight) => {
+            const id = `${key}:${tileWidth}×${tileHeight}`, cached = spectraByKey.get(id);
+            if (stats.cache('spectra', !!cached))
+                return spectraByKey.delete(id), spectraByKey.set(id, cached), cached;
+            const length = tileWidth * tileHeight, padded = new Float32Array(length), spectrum = new Float32Array(length * 2);
+            for (let j = 0; j < kernelHeight; j++)
+                padded.set(kernel.subarray(j * kernelWidth, (j + 1) * kernelWidth), j * tileWidth);
+            transform(padded, spectrum, 'forward'), spectraByKey.set(id, spectrum);
+            for (const id of spectraByKey.keys())
+                if (spectraByKey.size > convolution.limit)
+                    spectraByKey.delete(id);
+            return spectrum;
+        };
+        convolution.tiles = ({ key, kernel, kernelWidth, kernelHeight, tileWidth, tileHeight, tiles = [] }) => {
+            const length = tileWidth * tileHeight, spectrum = convolution.spectrum(key, kernel, kernelWidth, kernelHeight, tileWidth, tileHeight);
+            const product = new Float32Array(length * 2), intrim = new Float32Array(length * 2);
+            return tiles.map((tile) => {
+                transform(tile, product, 'forward');
+                for (let i = 0, r, a, b; i < length; i++)
+                    r = i * 2, a = product[r], b = product[r + 1],
+                        product[r] = a * spectrum[r] - b * spectrum[r + 1], product[r + 1] = a * spectrum[r + 1] + b * spectrum[r];
+                transform(product, intrim, 'inverse');
+                const output = new Float32Array(length);
+                for (let k = 0; k < length; k++)
+                    output[k] = intrim[k * 2] / length;
+                return output;
+            });
+        };
+        convolution.release = (key) => { for (const id of spectraByKey.keys())
+            id.startsWith(`${key}:`) && spectraByKey.delete(id); };
+        convolution.bytes = () => { let bytes = 0; for (const spectrum of spectraByKey.values())
+            bytes += spectrum.byteLength; return bytes; };
+    })(convolution || (convolution = {}));
+    FFT.convolution = convolution;
+    FFT.backend = backend;
+    FFT.wisdom = wisdom;
+    FFT.simd = simd;
+    const benchmark = ({ sizes = [64, 128, 256, 512], repeat = 5 } = {}) => {
+        const { preferred } = backend, results = [];
+        for (const width of sizes) {
+            const size = width * width, input = new Float32Array(size).map((v, i) => (i * 7919 % 256));
+            const outputs = {}, result = { size: width };
+            for (const name of ['js', 'wasm']) {
+                if (backend.set(name) !== name)
+                    continue;
+                const output = outputs[name] = new Float32Array(size * 2);
+                transform(input, output, 'forward');
+                const started = now();
+                for (let i = 0; i < repeat; i++)
+                    transform(input, output, 'forward');
+                result[name] = (now() - started) / repeat;
+            }
+            if (outputs.js && outputs.wasm) {
+                let error = 0, scale = 0;
+                for (let i = 0; i < size * 2; i++)
+                    error = Math.max(error, abs(outputs.js[i] - outputs.wasm[i])), scale = Math.max(scale, abs(outputs.js[i]));
+                result.speedup = result.js / result.wasm, result.error = error / (scale || 1);
+            }
+            results.push(result);
+        }
+        return backend.set(preferred), results;
+    };
+    FFT.benchmark = benchmark;
+    FFT.stats = stats;
     self.onmessage = (event) => {
-        let { data = {}, data: { action, input, output, buffer, uid } } = event;
+        let { data = {}, data: { action, input, output, buffer, uid, sent } } = event;
+        const received = now();
         if (action && /^(f|forward|i|inverse)$/.test(action)) {
             const inverse = action.startsWith('i');
             action = inverse ? 'inverse' : 'forward';
+            stats.action(action).count++;
+            sent > 0 && stats.record(action, 'queue', timeOrigin + received - sent);
             if (!output)
                 output = inverse ? new Float32Array(new SharedArrayBuffer(input.length * 4)) : new Float32Array(new SharedArrayBuffer(input.length * 4 * 2));
             if (action === 'forward')
@@ -126,19 +811,107 @@ var FFT;
                     operations[_uid].aborted = true;
             const operation = { uid, aborted: false };
             operations[uid] = operation;
+            const started = now();
             const done = transform(input, output, action, operation);
+            const computed = now();
             delete operations[uid];
+            operation.aborted && stats.action(action).aborted++;
+            stats.record(action, 'compute', computed - started);
             const reply = { uid, input, output, done };
             self.postMessage(reply, FFT.transferables(input.buffer, output.buffer));
+            stats.record(action, 'transfer', now() - computed);
         }
         else if (action === 'preGenerate') {
+            stats.action(action).count++;
             if (data.size > 0)
-                iterate.generate(data.size);
+                iterate.generate(data.size), stats.record(action, 'compute', now() - received);
         }
         else if (action === 'abort') {
+            stats.action(action).count++;
             if (uid in operations)
                 operations[uid].aborted = true, delete operations[uid];
         }
+        else if (action === 'batch') {
+            stats.action(action).count++;
+            const spectra = batches.forward(data.key, data.inputs);
+            stats.record(action, 'compute', now() - received);
+            self.postMessage({ uid, action, key: data.key, count: spectra.length });
+        }
+        else if (action === 'filterInverse') {
+            stats.action(action).count++;
+            sent > 0 && stats.record(action, 'queue', timeOrigin + received - sent);
+            const result = batches.filterInverse(data.key, data.filter, data.width, data) || { outputs: [], ranges: [] };
+            const computed = now();
+            stats.record(action, 'compute', computed - received);
+            const reply = Object.assign({ uid, action, key: data.key }, result);
+            self.postMessage(reply, FFT.transferables(...result.outputs.map(output => output.buffer), ...(result.magnitudes || []).map(magnitude => magnitude.buffer)));
+            stats.record(action, 'transfer', now() - computed);
+        }
+        else if (action === 'convolve') {
+            stats.action(action).count++;
+            sent > 0 && stats.record(action, 'queue', timeOrigin + received - sent);
+            const outputs = convolution.tiles(data);
+            const computed = now();
+            stats.record(action, 'compute', computed - received);
+            self.postMessage({ uid, action, key: data.key, outputs }, FFT.transferables(...outputs.map(output => output.buffer)));
+            stats.record(action, 'transfer', now() - computed);
+        }
+        else if (action === 'profiles') {
+            stats.action(action).count++;
+            sent > 0 && stats.record(action, 'queue', timeOrigin + received - sent);
+            const results = profiles.analyse(data.key, data.width) || [];
+            const computed = now();
+            stats.record(action, 'compute', computed - received);
+            self.postMessage({ uid, action, key: data.key, profiles: results }, FFT.transferables(...results.map(({ profile }) => profile.buffer)));
+            stats.record(action, 'transfer', now() - computed);
+        }
+        else if (action === 'score') {
+            stats.action(action).count++;
+            sent > 0 && stats.record(action, 'queue', timeOrigin + received - sent);
+            const result = scorers.run(data.key, data) || { scores: {}, labels: scorers.labels() };
+            stats.record(action, 'compute', now() - received);
+            self.postMessage(Object.assign({ uid, action, key: data.key }, result));
+        }
+        else if (action === 'scorer') {
+            self.postMessage({ uid, action, name: data.name, defined: scorers.define(data) });
+        }
+        else if (action === 'bootstrap') {
+            stats.action(action).count++;
+            sent > 0 && stats.record(action, 'queue', timeOrigin + received - sent);
+            const result = bootstrap.run(data);
+            stats.record(action, 'compute', now() - received);
+            self.postMessage(Object.assign({ uid, action }, result), FFT.transferables(...Object.values(result || {}).map(array => array && array.buffer)));
+        }
+        else if (action === 'calibrate') {
+            stats.action(action).count++;
+            const measurements = calibration.run(data.key, data.width);
+            stats.record(action, 'compute', now() - received);
+            self.postMessage({ uid, action, key: data.key, measurements });
+        }
+        else if (action === 'release') {
+            stats.action(action).count++;
+            batches.release(data.key), convolution.release(data.key);
+        }
+        else if (action === 'backend') {
+            self.postMessage({ uid, action, backend: backend.set(data.backend), supported: simd.supported() });
+        }
+        else if (action === 'wisdom') {
+            self.postMessage({ uid, action, wisdom: wisdom.set(data.wisdom) });
+        }
+        else if (action === 'tune') {
+            stats.action(action).count++;
+            const result = wisdom.tune(data);
+            stats.record(action, 'compute', now() - received);
+            self.postMessage(Object.assign({ uid, action }, result));
+        }
+        else if (action === 'benchmark') {
+            self.postMessage({ uid, action, backend: backend.name(), results: benchmark(data) });
+        }
+        else if (action === 'stats') {
+            const reply = { uid, action, stats: stats.snapshot() };
+            data.reset && stats.reset();
+            self.postMessage(reply);
+        }
         else {
             console.error(`Unsupported operation`, event);
         }
@@ -0,0 +1,173 @@
+// Responsive image derivatives for the documentation pages.
+//
+//   node scripts/derive-images.js [document …] [--widths 480,800,1200,1600] [--formats avif,webp] [--fallback 1200] [--force]
+//
+// Every <img> in the documents (default: content/History.md, index.html, README.md) that points into a local assets
+// folder is resized to each width up to its own, encoded in the modern formats, and recorded with its dimensions in
+// <assets>/derived/derivatives.json. Browsers without either format keep the original as the <img> src, unless
+// --fallback asks for a resized copy in the original format. The <img> is then rewritten in place as a <picture> with
+// srcset/sizes, an aspect-ratio so layout does not shift, and lazy loading for everything but the first image of each
+// document. Re-running only encodes missing or outdated derivatives and rewrites the markup the same way, so the
+// documents stay in sync with the manifest.
+//
+// Encoding uses sharp when it is installed, and otherwise Pillow through python3.
+import { promises as fs, existsSync, statSync } from 'fs';
+import { dirname, basename, extname, join, relative, resolve, posix } from 'path';
+import { spawnSync } from 'child_process';
+import { fileURLToPath } from 'url';
+
+const root = resolve(dirname(fileURLToPath(import.meta.url)), '..');
+const defaults = {
+    documents: ['content/History.md', 'index.html', 'README.md'],
+    widths: [480, 800, 1200, 1600], formats: ['avif', 'webp'], fallback: 0,
+    quality: { avif: 55, webp: 80, jpeg: 82, png: 100 },
+    sizes: '(min-width: 960px) 900px, 100vw',
+};
+const types = { avif: 'image/avif', webp: 'image/webp', png: 'image/png', jpeg: 'image/jpeg' };
+
+const parseArguments = (args, options = { documents: [] }) => {
+    for (let i = 0; i < args.length; i++)
+        args[i] === '--force' ? (options.force = true)
+            : args[i].startsWith('--') ? (options[args[i].slice(2)] = args[++i])
+                : options.documents.push(args[i]);
+    return options;
+};
+
+const backends = {
+    async sharp() {
+        const { default: sharp } = await import('sharp');
+        return {
+            name: 'sharp',
+            probe: (sources) => Promise.all(sources.map(async (source) => {
+                const { width, height } = await sharp(source).metadata();
+                return { source, width, height };
+            })),
+            encode: (jobs) => Promise.all(jobs.map(async ({ source, output, width, format, quality }) => {
+                let image = sharp(source).resize({ width, withoutEnlargement: true });
+                format === 'jpeg' && (image = image.flatten({ background: '#ffffff' }));
+                const { width: w, height: h, size: bytes } = await image[format](format === 'png' ? { compressionLevel: 9 } : { quality }).toFile(output);
+                return { output, width: w, height: h, bytes };
+            })),
+        };
+    },
+    async pillow() {
+        const script = `
+import json, os, sys
+from PIL import Image
+request = json.load(sys.stdin)
+if request['action'] == 'probe':
+    result = [dict(source=s, width=Image.open(s).size[0], height=Image.open(s).size[1]) for s in request['sources']]
+else:
+    result = []
+    for job in request['jobs']:
+        image = Image.open(job['source'])
+        image.load()
+        if image.width > job['width']:
+            image = image.resize((job['width'], round(image.height * job['width'] / image.width)), Image.LANCZOS)
+        if job['format'] == 'jpeg':
+            image = image.convert('RGBA')
+            flat = Image.new('RGB', image.size, (255, 255, 255))
+            flat.paste(image, mask=image.split()[3])
+            image = flat
+        options = dict(optimize=True) if job['format'] == 'png' else dict(quality=job['quality'])
+        if job['format'] == 'webp': options['method'] = 6
+        image.save(job['output'], job['format'].upper(), **options)
+        result.append(dict(output=job['output'], width=image.width, height=image.height, bytes=os.path.getsize(job['output'])))
+json.dump(result, sys.stdout)
+`;
+        const run = (request) => {
+            const { status, stdout, stderr, error } = spawnSync('python3', ['-c', script], { input: JSON.stringify(request), maxBuffer: 1 << 26 });
+            if (error || status) throw Error(`Pillow backend failed: ${error ? error.message : stderr}`);
+            return JSON.parse(stdout);
+        };
+        run({ action: 'probe', sources: [] });
+        return { name: 'pillow', probe: async (sources) => run({ action: 'probe', sources }), encode: async (jobs) => run({ action: 'encode', jobs }) };
+    },
+};
+
+const backend = async () => {
+    for (const name of ['sharp', 'pillow'])
+        try { return await backends[name](); } catch (exception) { }
+    throw Error(`No image backend: install sharp (npm i -D sharp) or Pillow (pip install pillow)`);
+};
+
+const images = /<picture data-source="([^"]+)">[\s\S]*?<\/picture>|<img\b[^>]*?\bsrc="(\.\/assets\/[^"]+\.(?:png|jpe?g))"[^>]*>/gi;
+const managed = /\s+(?:src|srcset|sizes|loading|decoding|fetchpriority|style)=(?:"[^"]*"|\S+)/gi;
+
+/** Rebuilds an <img>'s own attributes (width, alt, markout styles) around the managed ones. */
+const attributes = (tag) => tag.replace(/^<img\b/i, '').replace(/\s*\/?>$/, '').replace(managed, '').trim();
+
+const encodePath = (path) => path.split('/').map(encodeURIComponent).join('/');
+const derivedName = (source, width, format) => `${basename(source, extname(source)).replace(/[^\w.-]+/g, '_')}-${width}.${format}`;
+
+const picture = (src, entry, tag, { eager, sizes, formats, indent = '' }) => {
+    const url = (file) => `${posix.dirname(src)}/derived/${encodePath(file)}`;
+    const sources = formats.map(format => {
+        const candidates = entry.derivatives.filter(derivative => derivative.type === types[format]);
+        return candidates.length ? `<source type="${types[format]}" srcset="${candidates.map(({ file, width }) => `${url(file)} ${width}w`).join(', ')}" sizes="${sizes}" />` : '';
+    }).filter(Boolean);
+    const fallback = entry.derivatives.find(derivative => derivative.fallback) || { file: undefined };
+    const own = attributes(tag.match(/<img\b[^>]*>/i)[0]);
+    return [
+        `<picture data-source="${src}">`, ...sources,
+        `<img ${own} src="${fallback.file ? url(fallback.file) : src}" ${eager ? 'fetchpriority=high' : 'loading=lazy'} decoding=async style="aspect-ratio: ${entry.width} / ${entry.height}" />`,
+        `</picture>`,
+    ].join(`\n${indent}`);
+};
+
+const derive = async (options = {}) => {
+    const widths = `${options.widths || defaults.widths}`.split(',').map(Number).sort((a, b) => a - b);
+    const formats = `${options.formats || defaults.formats}`.split(',').filter(format => format in types), fallbackWidth = +(options.fallback || defaults.fallback);
+    const documents = (options.documents && options.documents.length ? options.documents : defaults.documents).map(document => resolve(root, document));
+    const engine = await backend(), manifests = new Map(), texts = new Map();
+    for (const document of documents) {
+        const text = await fs.readFile(document, 'utf8');
+        texts.set(document, text);
+        for (const [, derived, plain] of text.matchAll(images)) {
+            const src = derived || plain, source = resolve(dirname(document), src), folder = join(dirname(source), 'derived');
+            if (!existsSync(source)) continue;
+            manifests.has(folder) || manifests.set(folder, { file: join(folder, 'derivatives.json'), entries: {} });
+            manifests.get(folder).entries[basename(source)] = { source };
+        }
+    }
+    for (const [folder, manifest] of manifests) {
+        await fs.mkdir(folder, { recursive: true });
+        const previous = existsSync(manifest.file) ? JSON.parse(await fs.readFile(manifest.file, 'utf8')) : {};
+        const probes = await engine.probe(Object.values(manifest.entries).map(({ source }) => source)), jobs = [];
+        for (const { source, width, height } of probes) {
+            const name = basename(source), format = /\.jpe?g$/i.test(name) ? 'jpeg' : 'png', entry = manifest.entries[name] = { width, height, bytes: statSync(source).size, derivatives: [] };
+            const targets = [...new Set(widths.map(target => Math.min(target, width)))];
+            const plan = formats.map(format => targets.map(target => ({ format, width: target }))).flat();
+            fallbackWidth > 0 && plan.push({ format, width: Math.min(fallbackWidth, width), fallback: true });
+            for (const { format, width: target, fallback } of plan) {
+                const file = derivedName(name, target, format), output = join(folder, file), known = (previous[name] || { derivatives: [] }).derivatives.find(derivative => derivative.file === file);
+                const current = !options.force && known && existsSync(output) && statSync(output).mtimeMs >= statSync(source).mtimeMs;
+                entry.derivatives.push(Object.assign(current ? known : { file, type: types[format] }, fallback ? { fallback: true } : {}));
+                current || jobs.push({ source, output, width: target, format, quality: defaults.quality[format] });
+            }
+        }
+        for (const { output, width, height, bytes } of jobs.length ? await engine.encode(jobs) : []) {
+            const file = basename(output);
+            for (const entry of Object.values(manifest.entries))
+                for (const derivative of entry.derivatives)
+                    derivative.file === file && Object.assign(derivative, { width, height, bytes });
+        }
+        await fs.writeFile(manifest.file, JSON.stringify(manifest.entries, (key, value) => key === 'source' ? undefined : value, 1) + '\n');
+        console.log(`${relative(root, folder)}: ${jobs.length} encoded with ${engine.name}, ${Object.keys(manifest.entries).length} images`);
+    }
+    for (const [document, text] of texts) {
+        let first = true;
+        const rewritten = text.replace(images, (tag, derived, plain, offset) => {
+            const src = derived || plain, source = resolve(dirname(document), src), manifest = manifests.get(join(dirname(source), 'derived'));
+            const entry = manifest && manifest.entries[basename(source)];
+            if (!entry || !entry.derivatives) return tag;
+            const sizes = (tag.match(/data-sizes="([^"]+)"/) || [])[1] || (/\bwidth=75%/.test(tag) ? '(min-width: 960px) 675px, 75vw' : defaults.sizes);
+            const indent = text.slice(text.lastIndexOf('\n', offset) + 1, offset).match(/^\s*/)[0];
+            const markup = picture(src, entry, tag, { eager: first, sizes, formats, indent });
+            return first = false, markup;
+        });
+        rewritten === text || (await fs.writeFile(document, rewritten), console.log(`${relative(root, document)}: rewritten`));
+    }
+};
+
+derive(parseArguments(process.argv.slice(2))).catch((exception) => (console.error(exception.message || exception), process.exit(1)));